@@ -0,0 +1,127 @@
+import argparse
+import os
+import struct
+import yaml
+
+# Layout from \src\Registry\Define\Animation.cpp (Scene/Stage/Position binary Save/Load)
+MAGIC = b"SLSB"
+VERSION = 1
+ID_SIZE = 8
+POSITION = struct.Struct("<B4fb")
+
+argparser = argparse.ArgumentParser(description="Convert scene user settings between yaml and binary (.slsb).")
+argparser.add_argument("input", type=str, help="Settings file to convert (.yaml or .slsb)")
+argparser.add_argument("-o", "--output", type=str, default=None, help="Output file, defaults to the input file with swapped extension")
+args = argparser.parse_args()
+
+def write_id(out, value):
+  out += value.encode("utf-8")[:ID_SIZE].ljust(ID_SIZE, b"\0")
+
+def read_id(data, offset):
+  return data[offset:offset + ID_SIZE].rstrip(b"\0").decode("utf-8"), offset + ID_SIZE
+
+def stage_positions(node):
+  if isinstance(node, list):
+    return node
+  if not isinstance(node, dict):
+    return []
+  indices = sorted(k for k in node.keys() if isinstance(k, int))
+  return [node[i] for i in range(indices[-1] + 1)] if indices else []
+
+def yaml_to_binary(root):
+  out = bytearray(MAGIC)
+  out += struct.pack("<BI", VERSION, len(root))
+  for scene_id, scene in root.items():
+    scene = scene or {}
+    stages = {k: v for k, v in scene.items() if k != "enabled"}
+    record = bytearray(struct.pack("<BH", scene.get("enabled", True), len(stages)))
+    for stage_id, stage in stages.items():
+      positions = stage_positions(stage)
+      annotations = stage.get("annotations", []) if isinstance(stage, dict) else []
+      payload = bytearray(struct.pack("<B", len(positions)))
+      for position in positions:
+        position = position or {}
+        transform = position.get("transform")
+        if transform:
+          x, y, z = transform["Location"]
+          payload += POSITION.pack(1, x, y, z, transform["Rotation"], position.get("schlong", 0))
+        else:
+          payload += POSITION.pack(0, 0.0, 0.0, 0.0, 0.0, position.get("schlong", 0))
+      payload += struct.pack("<H", len(annotations))
+      for annotation in annotations:
+        encoded = str(annotation).encode("utf-8")
+        payload += struct.pack("<H", len(encoded)) + encoded
+      write_id(record, str(stage_id))
+      record += struct.pack("<I", len(payload)) + payload
+    write_id(out, str(scene_id))
+    out += struct.pack("<I", len(record)) + record
+  return bytes(out)
+
+def binary_to_yaml(data):
+  if data[:len(MAGIC)] != MAGIC:
+    raise ValueError("Not a scene settings file")
+  version, scene_count = struct.unpack_from("<BI", data, len(MAGIC))
+  if version > VERSION:
+    raise ValueError(f"Unsupported version {version}")
+  offset = len(MAGIC) + 5
+  root = {}
+  for _ in range(scene_count):
+    scene_id, offset = read_id(data, offset)
+    (size,) = struct.unpack_from("<I", data, offset)
+    offset += 4
+    end = offset + size
+    enabled, stage_count = struct.unpack_from("<BH", data, offset)
+    offset += 3
+    scene = {"enabled": bool(enabled)}
+    for _ in range(stage_count):
+      stage_id, offset = read_id(data, offset)
+      offset += 4
+      (position_count,) = struct.unpack_from("<B", data, offset)
+      offset += 1
+      positions = []
+      for _ in range(position_count):
+        changed, x, y, z, r, schlong = POSITION.unpack_from(data, offset)
+        offset += POSITION.size
+        positions.append((changed, x, y, z, r, schlong))
+      (annotation_count,) = struct.unpack_from("<H", data, offset)
+      offset += 2
+      annotations = []
+      for _ in range(annotation_count):
+        (length,) = struct.unpack_from("<H", data, offset)
+        offset += 2
+        annotations.append(data[offset:offset + length].decode("utf-8"))
+        offset += length
+      # Mirrors Stage::Save, positions are only listed if any of them has been adjusted
+      stage = {}
+      if annotations:
+        stage["annotations"] = annotations
+      if any(p[0] for p in positions):
+        for i, (_, x, y, z, r, schlong) in enumerate(positions):
+          stage[i] = {"transform": {"Location": [x, y, z], "Rotation": r}}
+          if schlong != 0:
+            stage[i]["schlong"] = schlong
+      scene[stage_id] = stage or None
+    root[scene_id] = scene
+    offset = end
+  return root
+
+def main():
+  base, ext = os.path.splitext(args.input)
+  if ext == ".slsb":
+    with open(args.input, "rb") as file:
+      root = binary_to_yaml(file.read())
+    output = args.output or base + ".yaml"
+    with open(output, "w") as file:
+      yaml.safe_dump(root, file, sort_keys=False)
+  elif ext in (".yaml", ".yml"):
+    with open(args.input, "r") as file:
+      root = yaml.safe_load(file) or {}
+    output = args.output or base + ".slsb"
+    with open(output, "wb") as file:
+      file.write(yaml_to_binary(root))
+  else:
+    print("Input must be a .yaml or .slsb file")
+    exit(1)
+  print(f"Converted {args.input} -> {output}")
+
+main()
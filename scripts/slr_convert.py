@@ -0,0 +1,233 @@
+import argparse
+import struct
+
+# Layout from \src\Registry\Define\Animation.cpp (AnimPackage, Scene, PositionInfo, Stage, Position)
+# Versions 1-4 are big-endian with floats stored as int32 / 1000, version 5 is little-endian with IEEE floats
+# and stores the byte offset of every scene after the scene count
+ID_SIZE = 8
+HASH_SIZE = 4
+MAX_VERSION = 5
+
+argparser = argparse.ArgumentParser(description="Convert .slr registry files between format versions.")
+argparser.add_argument("input", type=str, help=".slr file to convert")
+argparser.add_argument("-o", "--output", type=str, default=None, help="Output file, defaults to overwriting the input")
+argparser.add_argument("-v", "--version", type=int, default=MAX_VERSION, help="Target version (4 or 5)")
+argparser.add_argument("--verify", action="store_true", help="Only check that the file survives a round trip through version 5")
+args = argparser.parse_args()
+
+def f32(value):
+  return struct.unpack("<f", struct.pack("<f", value))[0]
+
+class Reader:
+  def __init__(self, data):
+    self.data = data
+    self.offset = 0
+    self.endian = ">"
+    self.version = 0
+
+  def take(self, size, field):
+    if self.offset + size > len(self.data):
+      raise ValueError(f"Unexpected end of data reading '{field}' at offset {self.offset}")
+    ret = self.data[self.offset:self.offset + size]
+    self.offset += size
+    return ret
+
+  def int(self, fmt, field):
+    return struct.unpack(self.endian + fmt, self.take(struct.calcsize(fmt), field))[0]
+
+  def float(self, field):
+    if self.version >= 5:
+      return self.int("f", field)
+    return f32(self.int("i", field) / 1000.0)
+
+  def string(self, field):
+    return self.take(self.int("Q", field), field)
+
+class Writer:
+  def __init__(self, version):
+    self.out = bytearray()
+    self.version = version
+    self.endian = "<" if version >= 5 else ">"
+
+  def int(self, fmt, value):
+    self.out += struct.pack(self.endian + fmt, value)
+
+  def float(self, value):
+    if self.version >= 5:
+      self.int("f", value)
+    else:
+      self.int("i", round(value * 1000.0))
+
+  def string(self, value):
+    self.int("Q", len(value))
+    self.out += value
+
+  def raw(self, value):
+    self.out += value
+
+def read_coordinate(r):
+  return [r.float("coordinate") for _ in range(4)]
+
+def read_tags(r):
+  return [r.string("tags.tag") for _ in range(r.int("Q", "tags.count"))]
+
+def read_position_info(r):
+  info = {
+    "race": r.take(1, "position_info.race"),
+    "sex": r.take(1, "position_info.sex"),
+    "scale": r.float("position_info.scale"),
+    "extra": r.take(1, "position_info.extra"),
+    "annotations": [],
+  }
+  if r.version > 1:
+    info["annotations"] = [r.string("position_info.annotation") for _ in range(r.int("Q", "position_info.annotation_count"))]
+  return info
+
+def read_position(r):
+  return {
+    "event": r.string("position.event"),
+    "climax": r.int("B", "position.climax"),
+    "offset": read_coordinate(r),
+    "strips": r.int("B", "position.strips"),
+    "schlong": r.int("b", "position.schlong") if r.version >= 3 else 0,
+  }
+
+def read_stage(r):
+  stage = {"id": r.take(ID_SIZE, "stage.id")}
+  stage["positions"] = [read_position(r) for _ in range(r.int("Q", "stage.position_count"))]
+  if r.version >= 5:
+    stage["fixedlength"] = r.float("stage.fixedlength")
+  elif r.version >= 4:
+    stage["fixedlength"] = f32(r.int("I", "stage.fixedlength") / 1000.0)
+  else:
+    stage["fixedlength"] = f32(r.float("stage.fixedlength") / 1000.0)
+  stage["navtext"] = r.string("stage.navtext")
+  stage["tags"] = read_tags(r)
+  return stage
+
+def read_scene(r):
+  scene = {"id": r.take(ID_SIZE, "scene.id"), "name": r.string("scene.name")}
+  scene["positions"] = [read_position_info(r) for _ in range(r.int("Q", "scene.position_count"))]
+  scene["start"] = r.take(ID_SIZE, "scene.start_stage")
+  scene["stages"] = [read_stage(r) for _ in range(r.int("Q", "scene.stage_count"))]
+  graph = []
+  for _ in range(r.int("Q", "scene.graph_vertex_count")):
+    vertex = r.take(ID_SIZE, "scene.graph_vertex")
+    edges = [r.take(ID_SIZE, "scene.graph_edge") for _ in range(r.int("Q", "scene.graph_edge_count"))]
+    graph.append((vertex, edges))
+  scene["graph"] = graph
+  # Furniture types and flags are copied as they are, the plugin reads them without conversion
+  scene["furniture"] = r.take(4, "scene.furniture_types")
+  scene["allow_bed"] = r.take(1, "scene.allow_bed")
+  scene["furniture_offset"] = read_coordinate(r)
+  scene["private"] = r.take(1, "scene.private")
+  return scene
+
+def read_package(data):
+  r = Reader(data)
+  r.version = data[0]
+  r.offset = 1
+  if r.version < 1 or r.version > MAX_VERSION:
+    raise ValueError(f"Invalid version: {r.version}")
+  r.endian = "<" if r.version >= 5 else ">"
+  package = {"version": r.version, "name": r.string("package.name"), "author": r.string("package.author")}
+  package["hash"] = r.take(HASH_SIZE, "package.hash")
+  count = r.int("Q", "package.scene_count")
+  if r.version >= 5:
+    offsets = [r.int("Q", "package.scene_offset") for _ in range(count)]
+    scenes = []
+    for offset in offsets:
+      r.offset = offset
+      scenes.append(read_scene(r))
+  else:
+    scenes = [read_scene(r) for _ in range(count)]
+  package["scenes"] = scenes
+  return package
+
+def write_coordinate(w, coordinate):
+  for value in coordinate:
+    w.float(value)
+
+def write_scene(w, scene):
+  w.raw(scene["id"])
+  w.string(scene["name"])
+  w.int("Q", len(scene["positions"]))
+  for info in scene["positions"]:
+    w.raw(info["race"])
+    w.raw(info["sex"])
+    w.float(info["scale"])
+    w.raw(info["extra"])
+    w.int("Q", len(info["annotations"]))
+    for annotation in info["annotations"]:
+      w.string(annotation)
+  w.raw(scene["start"])
+  w.int("Q", len(scene["stages"]))
+  for stage in scene["stages"]:
+    w.raw(stage["id"])
+    w.int("Q", len(stage["positions"]))
+    for position in stage["positions"]:
+      w.string(position["event"])
+      w.int("B", position["climax"])
+      write_coordinate(w, position["offset"])
+      w.int("B", position["strips"])
+      w.int("b", position["schlong"])
+    if w.version >= 5:
+      w.float(stage["fixedlength"])
+    else:
+      w.int("I", round(stage["fixedlength"] * 1000.0))
+    w.string(stage["navtext"])
+    w.int("Q", len(stage["tags"]))
+    for tag in stage["tags"]:
+      w.string(tag)
+  w.int("Q", len(scene["graph"]))
+  for vertex, edges in scene["graph"]:
+    w.raw(vertex)
+    w.int("Q", len(edges))
+    for edge in edges:
+      w.raw(edge)
+  w.raw(scene["furniture"])
+  w.raw(scene["allow_bed"])
+  write_coordinate(w, scene["furniture_offset"])
+  w.raw(scene["private"])
+
+def write_package(package, version):
+  w = Writer(version)
+  w.raw(bytes([version]))
+  w.string(package["name"])
+  w.string(package["author"])
+  w.raw(package["hash"])
+  w.int("Q", len(package["scenes"]))
+  if version < 5:
+    for scene in package["scenes"]:
+      write_scene(w, scene)
+    return bytes(w.out)
+  table = len(w.out)
+  w.raw(bytes(8 * len(package["scenes"])))
+  for i, scene in enumerate(package["scenes"]):
+    struct.pack_into("<Q", w.out, table + 8 * i, len(w.out))
+    write_scene(w, scene)
+  return bytes(w.out)
+
+def main():
+  with open(args.input, "rb") as file:
+    data = file.read()
+  package = read_package(data)
+  if args.verify:
+    # Versions before 4 stored stage lengths with a different precision, so only version 5 is lossless for them
+    for version in (5, 4) if package["version"] >= 4 else (5,):
+      converted = read_package(write_package(package, version))
+      converted["version"] = package["version"]
+      if converted != package:
+        print(f"Round trip through version {version} changed the contents of {args.input}")
+        exit(1)
+    print(f"Round trip of {args.input} (version {package['version']}, {len(package['scenes'])} scenes) succeeded")
+    return
+  if args.version not in (4, 5):
+    print("Target version must be 4 or 5")
+    exit(1)
+  output = args.output or args.input
+  with open(output, "wb") as file:
+    file.write(write_package(package, args.version))
+  print(f"Converted {args.input} (version {package['version']}) -> {output} (version {args.version})")
+
+main()
@@ -236,6 +236,71 @@ namespace Papyrus::SexLabRegistry
 		return ret;
 	}
 
+	static std::optional<std::vector<Registry::Library::PartialMatch>> LookupPartialMatches(STATICARGS,
+		const std::vector<RE::Actor*>& a_positions, int32_t a_open, const std::string& a_tags, const std::vector<RE::Actor*>& a_submissives)
+	{
+		if (a_positions.empty() || std::ranges::find(a_positions, nullptr) != a_positions.end()) {
+			a_vm->TraceStack("Cannot lookup animations without actors", a_stackID);
+			return std::nullopt;
+		}
+		if (std::ranges::find(a_submissives, nullptr) != a_submissives.end()) {
+			a_vm->TraceStack("None actor in submissives", a_stackID);
+			return std::nullopt;
+		}
+		if (a_open < 0) {
+			a_vm->TraceStack("Number of open positions must not be negative", a_stackID);
+			return std::nullopt;
+		}
+		const auto tags = Util::StringSplit(a_tags, ",");
+		return Registry::Library::GetSingleton()->LookupPartialScenes(a_positions, a_open, tags, a_submissives);
+	}
+
+	std::vector<RE::BSFixedString> LookupPartialScenes(STATICARGS,
+		std::vector<RE::Actor*> a_positions, int32_t a_open, std::string a_tags, std::vector<RE::Actor*> a_submissives)
+	{
+		const auto matches = LookupPartialMatches(a_vm, a_stackID, nullptr, a_positions, a_open, a_tags, a_submissives);
+		if (!matches)
+			return {};
+		// One entry per match, a scene appears once for every distinct set of open fragments it can be completed with
+		std::vector<RE::BSFixedString> ret{};
+		ret.reserve(matches->size());
+		for (auto&& match : *matches)
+			ret.push_back(match.scene->id);
+		return ret;
+	}
+
+	std::vector<int32_t> LookupPartialSceneFragments(STATICARGS,
+		std::vector<RE::Actor*> a_positions, int32_t a_open, std::string a_tags, std::vector<RE::Actor*> a_submissives)
+	{
+		const auto matches = LookupPartialMatches(a_vm, a_stackID, nullptr, a_positions, a_open, a_tags, a_submissives);
+		if (!matches)
+			return {};
+		// Parallel to LookupPartialScenes: the open fragments of the i-th match are at [i * a_open, (i + 1) * a_open)
+		std::vector<int32_t> ret{};
+		ret.reserve(matches->size() * a_open);
+		for (auto&& match : *matches) {
+			for (auto&& fragment : match.open)
+				ret.push_back(static_cast<int32_t>(fragment.GetValue()));
+		}
+		return ret;
+	}
+
+	std::vector<int32_t> GetTagFacets(STATICARGS,
+		std::vector<RE::Actor*> a_positions, std::string a_tags, std::vector<RE::Actor*> a_submissives, std::vector<RE::BSFixedString> a_candidates)
+	{
+		if (a_positions.empty() || std::ranges::find(a_positions, nullptr) != a_positions.end()) {
+			a_vm->TraceStack("Cannot lookup animations without actors", a_stackID);
+			return {};
+		}
+		if (std::ranges::find(a_submissives, nullptr) != a_submissives.end()) {
+			a_vm->TraceStack("None actor in submissives", a_stackID);
+			return {};
+		}
+		const auto tags = Util::StringSplit(a_tags, ",");
+		const auto counts = Registry::Library::GetSingleton()->GetTagFacets(a_positions, tags, a_submissives, a_candidates);
+		return { counts.begin(), counts.end() };
+	}
+
 	bool ValidateScene(STATICARGS,
 		RE::BSFixedString a_sceneid, std::vector<RE::Actor*> a_positions, std::string a_tags, RE::Actor* a_submissive)
 	{
@@ -438,7 +503,7 @@ namespace Papyrus::SexLabRegistry
 	bool IsSceneEnabled(STATICARGS, RE::BSFixedString a_id)
 	{
 		SCENE(false);
-		return scene->enabled;
+		return scene->IsEnabled();
 	}
 
 	void SetSceneEnabled(STATICARGS, RE::BSFixedString a_id, bool a_enabled)
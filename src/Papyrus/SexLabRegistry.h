@@ -28,6 +28,12 @@ namespace Papyrus::SexLabRegistry
 		std::vector<RE::Actor*> a_positions, std::string a_tags, RE::Actor* a_submissives, FurniturePreference a_furniturepref, RE::TESObjectREFR* a_center);
 	std::vector<RE::BSFixedString> LookupScenesA(STATICARGS, 
 		std::vector<RE::Actor*> a_positions, std::string a_tags, std::vector<RE::Actor*> a_submissives, FurniturePreference a_furniturepref, RE::TESObjectREFR* a_center);
+	std::vector<RE::BSFixedString> LookupPartialScenes(STATICARGS,
+		std::vector<RE::Actor*> a_positions, int32_t a_open, std::string a_tags, std::vector<RE::Actor*> a_submissives);
+	std::vector<int32_t> LookupPartialSceneFragments(STATICARGS,
+		std::vector<RE::Actor*> a_positions, int32_t a_open, std::string a_tags, std::vector<RE::Actor*> a_submissives);
+	std::vector<int32_t> GetTagFacets(STATICARGS,
+		std::vector<RE::Actor*> a_positions, std::string a_tags, std::vector<RE::Actor*> a_submissives, std::vector<RE::BSFixedString> a_candidates);
 	bool ValidateScene(STATICARGS, RE::BSFixedString a_sceneid, std::vector<RE::Actor*> a_positions, std::string a_tags, RE::Actor* a_submissive);
 	bool ValidateSceneA(STATICARGS, RE::BSFixedString a_sceneid, std::vector<RE::Actor*> a_positions, std::string a_tags, std::vector<RE::Actor*> a_submissives);
 	std::vector<RE::BSFixedString> ValidateScenes(STATICARGS, 
@@ -130,6 +136,9 @@ namespace Papyrus::SexLabRegistry
 
 		REGISTERFUNC(LookupScenes, "SexLabRegistry", true);
 		REGISTERFUNC(LookupScenesA, "SexLabRegistry", true);
+		REGISTERFUNC(LookupPartialScenes, "SexLabRegistry", true);
+		REGISTERFUNC(LookupPartialSceneFragments, "SexLabRegistry", true);
+		REGISTERFUNC(GetTagFacets, "SexLabRegistry", true);
 		REGISTERFUNC(ValidateScene, "SexLabRegistry", true);
 		REGISTERFUNC(ValidateSceneA, "SexLabRegistry", true);
 		REGISTERFUNC(ValidateScenes, "SexLabRegistry", true);
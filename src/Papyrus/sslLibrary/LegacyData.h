@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Registry/Define/ActorProfile.h"
 #include "Registry/Define/Sex.h"
 
 namespace Papyrus
@@ -14,11 +15,10 @@ namespace Papyrus
     None = -1,
   };
 
-  inline LegacySex GetLegacySex(RE::Actor* a_actor)
+  inline LegacySex GetLegacySex(RE::Actor* a_actor, Registry::Sex a_sex)
 	{
 		auto creature = !a_actor->IsHumanoid();
-		auto sex = Registry::GetSex(a_actor);
-		switch (sex) {
+		switch (a_sex) {
 		case Registry::Sex::None:
 		case Registry::Sex::Male:
       return creature ? CrtMale : Male;
@@ -29,6 +29,16 @@ namespace Papyrus
 		return LegacySex::Male;
 	}
 
+	inline LegacySex GetLegacySex(RE::Actor* a_actor, const Registry::ActorProfile& a_profile)
+	{
+		return GetLegacySex(a_actor, Registry::GetSex(a_actor, a_profile));
+	}
+
+	inline LegacySex GetLegacySex(RE::Actor* a_actor)
+	{
+		return GetLegacySex(a_actor, Registry::GetSex(a_actor));
+	}
+
 	inline std::array<int32_t, 4> GetLegacySex(std::vector<RE::Actor*> a_positions)
 	{
 		std::array<int32_t, 4> ret{ 0, 0, 0, 0 };
@@ -1,6 +1,7 @@
 #include "sslThreadLibrary.h"
 
 #include "Serialize.h"
+#include "Registry/Define/ActorProfile.h"
 #include "Registry/Define/Animation.h"
 #include "Registry/Define/Fragment.h"
 #include "Registry/Define/Furniture.h"
@@ -90,9 +91,10 @@ namespace Papyrus::ThreadLibrary
 
 			if (!targetrace.IsCompatibleWith(actor.get()))
 				continue;
-			if (targetsex != LegacySex::None && GetLegacySex(actor.get()) != targetsex)
+			const Registry::ActorProfile profile{ actor.get() };
+			if (targetsex != LegacySex::None && GetLegacySex(actor.get(), profile) != targetsex)
 				continue;
-			if (!Registry::IsValidActor(actor.get()))
+			if (Registry::IsValidActorImpl(actor.get(), profile) <= 0)
 				continue;
 
 			ret.push_back(actor.get());
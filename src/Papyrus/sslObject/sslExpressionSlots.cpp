@@ -152,12 +152,13 @@ namespace Papyrus::ExpressionSlots
 
 		std::vector<float> GetValues(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::BSFixedString a_id, bool a_female, float a_strength)
 		{
-			auto profile = Registry::Library::GetSingleton()->GetExpressionById(a_id);
+			const auto library = Registry::Library::GetSingleton();
+			const auto profile = library->GetExpressionById(a_id);
 			if (!profile) {
 				a_vm->TraceStack("Invalid Expression Profile ID", a_stackID);
 				return std::vector<float>(Registry::Expression::Total);
 			}
-			auto ret = profile->GetData(a_female ? RE::SEXES::kFemale : RE::SEXES::kMale, a_strength);
+			const auto ret = library->GetExpressionData(profile, a_female ? RE::SEXES::kFemale : RE::SEXES::kMale, a_strength);
 			return { ret.begin(), ret.end() };
 		}
 
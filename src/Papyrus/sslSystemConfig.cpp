@@ -1,6 +1,7 @@
 #include "sslSystemConfig.h"
 
 #include "Registry/Library.h"
+#include "Registry/Util/FragmentCache.h"
 #include "UserData/StripData.h"
 
 namespace Papyrus::SystemConfig
@@ -140,6 +141,40 @@ namespace Papyrus::SystemConfig
 		return static_cast<int32_t>(Registry::Library::GetSingleton()->GetSceneCount());
 	}
 
+	std::vector<int> GetSceneSaveStatistics(RE::StaticFunctionTag*)
+	{
+		const auto stats = Registry::Library::GetSingleton()->GetSceneSaveStatistics();
+		return { static_cast<int32_t>(stats.files), static_cast<int32_t>(stats.bytes) };
+	}
+
+	std::string GetRegistryReport(RE::StaticFunctionTag*)
+	{
+		return Registry::Library::GetSingleton()->GetRegistryReport().dump();
+	}
+
+	void PrintRegistryReport(RE::StaticFunctionTag*)
+	{
+		Util::PrintConsole(Registry::Library::GetSingleton()->GetRegistryReport().dump(2));
+	}
+
+	std::vector<int> GetFragmentCacheStatistics(RE::StaticFunctionTag*)
+	{
+		const auto stats = Registry::FragmentCache::GetSingleton()->GetStatistics();
+		const auto total = stats.hits + stats.misses;
+		const auto hitRate = total ? static_cast<int32_t>(stats.hits * 100 / total) : 0;
+		return { static_cast<int32_t>(stats.hits), static_cast<int32_t>(stats.misses), static_cast<int32_t>(stats.entries), hitRate };
+	}
+
+	void InvalidateFragmentCache(RE::StaticFunctionTag*, RE::Actor* a_actor)
+	{
+		const auto cache = Registry::FragmentCache::GetSingleton();
+		if (a_actor) {
+			cache->Invalidate(a_actor->GetFormID());
+		} else {
+			cache->Clear();
+		}
+	}
+
 	std::vector<float> GetEnjoymentFactors(RE::StaticFunctionTag*)
 	{
 		return {
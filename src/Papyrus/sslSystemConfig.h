@@ -5,6 +5,11 @@ namespace Papyrus::SystemConfig
 	float GetMinSetupTime(RE::StaticFunctionTag*);
 
 	int GetAnimationCount(RE::StaticFunctionTag*);
+	std::vector<int> GetSceneSaveStatistics(RE::StaticFunctionTag*);
+	std::string GetRegistryReport(RE::StaticFunctionTag*);
+	void PrintRegistryReport(RE::StaticFunctionTag*);
+	std::vector<int> GetFragmentCacheStatistics(RE::StaticFunctionTag*);
+	void InvalidateFragmentCache(RE::StaticFunctionTag*, RE::Actor* a_actor);
 	std::vector<float> GetEnjoymentFactors(RE::StaticFunctionTag*);
 	int GetEnjoymentSettingInt(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::BSFixedString a_setting);
 	float GetEnjoymentSettingFlt(VM* a_vm, StackID a_stackID, RE::StaticFunctionTag*, RE::BSFixedString a_setting);
@@ -29,6 +34,11 @@ namespace Papyrus::SystemConfig
 		REGISTERFUNC(GetMinSetupTime, "sslSystemConfig", true);
 
 		REGISTERFUNC(GetAnimationCount, "sslSystemConfig", true);
+		REGISTERFUNC(GetSceneSaveStatistics, "sslSystemConfig", true);
+		REGISTERFUNC(GetRegistryReport, "sslSystemConfig", true);
+		REGISTERFUNC(PrintRegistryReport, "sslSystemConfig", true);
+		REGISTERFUNC(GetFragmentCacheStatistics, "sslSystemConfig", true);
+		REGISTERFUNC(InvalidateFragmentCache, "sslSystemConfig", true);
 		REGISTERFUNC(GetEnjoymentFactors, "sslSystemConfig", true);
 		REGISTERFUNC(GetEnjoymentSettingInt, "sslSystemConfig", true);
 		REGISTERFUNC(GetEnjoymentSettingFlt, "sslSystemConfig", true);
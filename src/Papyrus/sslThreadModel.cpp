@@ -5,8 +5,10 @@
 #include "Registry/Util/RayCast.h"
 #include "Registry/Util/RayCast/ObjectBound.h"
 #include "Registry/Util/Scale.h"
+#include "Thread/Expression/ExpressionAnimator.h"
 #include "Thread/NiNode/Node.h"
 #include "Thread/Thread.h"
+#include "Thread/Voice/VoiceScheduler.h"
 #include "UserData/StripData.h"
 #include "Util/Script.h"
 #include "Util/StringUtil.h"
@@ -55,13 +57,54 @@ namespace Papyrus::ThreadModel
 		void SetActorVoiceImpl(ALIASARGS, RE::BSFixedString a_voice)
 		{
 			GET_POSITION();
-			position->voice = Registry::Library::GetSingleton()->GetVoiceById(a_voice);
+			instance->SetVoice(actor, Registry::Library::GetSingleton()->GetVoiceById(a_voice));
+		}
+
+		void SetVoiceScheduled(ALIASARGS, bool a_scheduled, float a_minInterval, float a_maxInterval)
+		{
+			GET_POSITION();
+			const auto scheduler = Thread::VoiceScheduler::GetSingleton();
+			if (!a_scheduled) {
+				scheduler->Unregister(actor->GetFormID());
+				return;
+			}
+			if (!position->voice) {
+				a_vm->TraceStack("Cannot schedule voice for an actor without voice", a_stackID);
+				return;
+			}
+			scheduler->Register(actor, position->voice);
+			if (a_minInterval > 0.0f && a_maxInterval > 0.0f) {
+				scheduler->SetInterval(actor->GetFormID(), { a_minInterval, a_maxInterval });
+			}
+		}
+
+		void SetVoiceMuffled(ALIASARGS, bool a_muffled)
+		{
+			GET_POSITION();
+			Thread::VoiceScheduler::GetSingleton()->SetMuffled(actor->GetFormID(), a_muffled);
+		}
+
+		void PlayOrgasmVoice(ALIASARGS)
+		{
+			GET_POSITION();
+			Thread::VoiceScheduler::GetSingleton()->QueueOrgasm(actor->GetFormID());
 		}
 
 		void SetActorExpressionImpl(ALIASARGS, RE::BSFixedString a_expression)
 		{
 			GET_POSITION();
-			position->expression = Registry::Library::GetSingleton()->GetExpressionById(a_expression);
+			instance->SetExpression(actor, Registry::Library::GetSingleton()->GetExpressionById(a_expression));
+		}
+
+		void SetExpressionAnimated(ALIASARGS, bool a_animated, float a_strength)
+		{
+			GET_POSITION();
+			const auto animator = Thread::ExpressionAnimator::GetSingleton();
+			if (a_animated) {
+				animator->Register(actor, position->expression, a_strength);
+			} else {
+				animator->Unregister(actor->GetFormID());
+			}
 		}
 
 		void LockActorImpl(ALIASARGS)
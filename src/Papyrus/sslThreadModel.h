@@ -23,6 +23,12 @@ namespace Papyrus::ThreadModel
 		RE::BSFixedString GetActorExpression(ALIASARGS);
 		void SetActorVoiceImpl(ALIASARGS, RE::BSFixedString a_voice);
 		void SetActorExpressionImpl(ALIASARGS, RE::BSFixedString a_expression);
+		/// @brief Let the native voice scheduler play this actor's voice, intervals <= 0 keep the INI defaults
+		void SetVoiceScheduled(ALIASARGS, bool a_scheduled, float a_minInterval, float a_maxInterval);
+		void SetVoiceMuffled(ALIASARGS, bool a_muffled);
+		void PlayOrgasmVoice(ALIASARGS);
+		/// @brief Let the native expression animator blend this actor's expression, starting at the given strength
+		void SetExpressionAnimated(ALIASARGS, bool a_animated, float a_strength);
 
 		void LockActorImpl(ALIASARGS);
 		void UnlockActorImpl(ALIASARGS);
@@ -38,6 +44,10 @@ namespace Papyrus::ThreadModel
 			REGISTERFUNC(GetActorExpression, "sslActorAlias", false);
 			REGISTERFUNC(SetActorVoiceImpl, "sslActorAlias", false);
 			REGISTERFUNC(SetActorExpressionImpl, "sslActorAlias", false);
+			REGISTERFUNC(SetVoiceScheduled, "sslActorAlias", false);
+			REGISTERFUNC(SetVoiceMuffled, "sslActorAlias", false);
+			REGISTERFUNC(PlayOrgasmVoice, "sslActorAlias", false);
+			REGISTERFUNC(SetExpressionAnimated, "sslActorAlias", false);
 
 			REGISTERFUNC(LockActorImpl, "sslActorAlias", false);
 			REGISTERFUNC(UnlockActorImpl, "sslActorAlias", false);
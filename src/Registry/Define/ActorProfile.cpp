@@ -0,0 +1,78 @@
+#include "ActorProfile.h"
+
+#include "Util/StringUtil.h"
+
+namespace Registry
+{
+	static uint64_t HashFaction(const RE::TESFaction* a_faction, int8_t a_rank)
+	{
+		auto x = (static_cast<uint64_t>(a_faction->GetFormID()) << 8 | static_cast<uint8_t>(a_rank)) * 0x9E3779B97F4A7C15;
+		return x ^ (x >> 32);
+	}
+
+	ActorProfile::ActorProfile(RE::Actor* a_actor)
+	{
+		static const auto sosfaction = RE::TESDataHandler::GetSingleton()->LookupForm<RE::TESFaction>(0x00AFF8, "Schlongs of Skyrim.esp");
+		bool excluded = false;
+		a_actor->VisitFactions([&](RE::TESFaction* a_faction, int8_t a_rank) {
+			if (!a_faction || a_rank < 0)
+				return false;
+			factions.push_back(a_faction);
+			fingerprint += HashFaction(a_faction, a_rank);
+			if (a_faction == GameForms::GenderFaction) {
+				switch (a_rank) {
+				case 0:
+					sexOverride = Sex::Male;
+					break;
+				case 1:
+					sexOverride = Sex::Female;
+					break;
+				case 2:
+					sexOverride = Sex::Futa;
+					break;
+				default:
+					logger::info("Actor {} has invalid gender faction rank ({})", a_actor->GetFormID(), a_rank);
+					break;
+				}
+			} else if (a_faction == GameForms::AnimatingFaction) {
+				animating = true;
+			} else if (a_faction == GameForms::ForbiddenFaction) {
+				forbidden = true;
+			} else if (sosfaction && a_faction == sosfaction) {
+				schlongified = true;
+			} else if (std::ranges::contains(Settings::SOS_ExcludeFactions, a_faction->formID)) {
+				excluded = true;
+			}
+			return false;
+		});
+		std::ranges::sort(factions, {}, [](const RE::TESFaction* a_faction) { return a_faction->GetFormID(); });
+		// Name checks are expensive, only needed for the few actors that have a schlong to begin with
+		if (schlongified && !excluded) {
+			excluded = std::ranges::any_of(factions, [](const RE::TESFaction* a_faction) {
+				std::string name{ a_faction->GetFullName() };
+				Util::ToLower(name);
+				return name.find("pubic") != std::string::npos;
+			});
+		}
+		schlongified &= !excluded;
+	}
+
+	uint64_t ActorProfile::GetFactionFingerprint(RE::Actor* a_actor)
+	{
+		uint64_t ret = 0;
+		a_actor->VisitFactions([&](RE::TESFaction* a_faction, int8_t a_rank) {
+			if (a_faction && a_rank >= 0) {
+				ret += HashFaction(a_faction, a_rank);
+			}
+			return false;
+		});
+		return ret;
+	}
+
+	bool ActorProfile::HasFaction(RE::FormID a_faction) const
+	{
+		const auto where = std::ranges::lower_bound(factions, a_faction, {}, [](const RE::TESFaction* a_it) { return a_it->GetFormID(); });
+		return where != factions.end() && (*where)->GetFormID() == a_faction;
+	}
+
+}	 // namespace Registry
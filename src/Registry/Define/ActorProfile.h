@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Sex.h"
+
+namespace Registry
+{
+	/// @brief Faction derived state of an actor, gathered in a single VisitFactions pass
+	/// Build one profile and pass it on when an actor needs to be checked for more than one of these
+	struct ActorProfile
+	{
+		ActorProfile(RE::Actor* a_actor);
+		~ActorProfile() = default;
+
+		_NODISCARD bool HasFaction(RE::FormID a_faction) const;
+
+		/// @brief Order independent hash of every faction and rank of this actor, equal to the fingerprint of a profile built from the same factions
+		/// Walks the factions without allocating, to cheaply tell if a profile (or anything derived from one) is outdated
+		_NODISCARD static uint64_t GetFactionFingerprint(RE::Actor* a_actor);
+
+		Sex sexOverride{ Sex::None };	 // From the rank in GenderFaction, None if not a member
+		bool schlongified{ false };		 // In the SOS faction and not excluded by Settings::SOS_ExcludeFactions or a pubic hair faction
+		bool animating{ false };
+		bool forbidden{ false };
+		std::vector<const RE::TESFaction*> factions{};	// Every faction with a non-negative rank, sorted by FormID
+		uint64_t fingerprint{ 0 };
+	};
+
+}	 // namespace Registry
@@ -2,7 +2,9 @@
 
 #include "Registry/Define/RaceKey.h"
 #include "Registry/Library.h"
+#include "Registry/Util/Binary.h"
 #include "Registry/Util/Decode.h"
+#include "Registry/Util/Pool.h"
 #include "Util/Combinatorics.h"
 #include "Util/StringUtil.h"
 
@@ -10,46 +12,79 @@ namespace Registry
 {
 	AnimPackage::AnimPackage(const fs::path a_file)
 	{
-		std::ifstream stream(a_file, std::ios::binary);
-		stream.unsetf(std::ios::skipws);
-		stream.exceptions(std::fstream::eofbit);
-		stream.exceptions(std::fstream::badbit);
-		stream.exceptions(std::fstream::failbit);
+		file = a_file;
+		const auto buffer = Decode::LoadFile(a_file);
+		Decode::Cursor cursor{ buffer };
 
 		uint8_t version;
 		constexpr uint8_t MIN_VERSION = 1;
-		constexpr uint8_t MAX_VERSION = 4;
-		stream.read(reinterpret_cast<char*>(&version), 1);
+		constexpr uint8_t MAX_VERSION = 5;
+		Decode::Read(cursor, version, "package.version");
 		if (version < MIN_VERSION || version > MAX_VERSION) {
 			const auto err = std::format("Invalid version: {}", version);
 			throw std::runtime_error(err.c_str());
 		}
-		Decode::Read(stream, name);
-		Decode::Read(stream, author);
-		hash.resize(Decode::HASH_SIZE);
-		stream.read(hash.data(), Decode::HASH_SIZE);
-
-		uint64_t scene_count;
-		Decode::Read(stream, scene_count);
+		cursor.SetFormat(Decode::GetFormat(version));
+		Decode::Read(cursor, name, "package.name");
+		Decode::Read(cursor, author, "package.author");
+		hash = Decode::ReadId(cursor, Decode::HASH_SIZE, "package.hash");
+
+		// Every scene takes at least its id, version 5 also stores an offset per scene
+		const auto scene_count = Decode::ReadCount(cursor, version < 5 ? Decode::ID_SIZE : sizeof(uint64_t), "package.scene_count");
+		if (version < 5) {
+			scenes.reserve(scene_count);
+			for (size_t i = 0; i < scene_count; i++) {
+				scenes.push_back(
+					std::make_unique<Scene>(cursor, hash, file, version));
+			}
+			if (cursor.GetRemaining() > 0) {
+				logger::warn("{}: {} trailing bytes after last scene at offset {}", a_file.filename().string(), cursor.GetRemaining(), cursor.GetOffset());
+			}
+			return;
+		}
+		// Version 5 stores the offset of every scene, allowing them to be decoded independently
+		std::vector<uint64_t> offsets(scene_count + 1);
+		for (size_t i = 0; i < scene_count; i++) {
+			Decode::Read(cursor, offsets[i], "package.scene_offset");
+		}
+		offsets[scene_count] = buffer.size();
+		for (size_t i = 0; i < scene_count; i++) {
+			if (offsets[i] < cursor.GetOffset() || offsets[i] > offsets[i + 1]) {
+				const auto err = std::format("Invalid offset {} for scene {}", offsets[i], i);
+				throw std::runtime_error(err.c_str());
+			}
+		}
+		// Packages are already loaded in parallel, one per thread, so scenes within a package are decoded in order
 		scenes.reserve(scene_count);
 		for (size_t i = 0; i < scene_count; i++) {
-			scenes.push_back(
-				std::make_unique<Scene>(stream, hash, version));
+			const std::span<const char> data{ buffer.data() + offsets[i], offsets[i + 1] - offsets[i] };
+			Decode::Cursor sceneCursor{ data, Decode::Format::Native, offsets[i] };
+			scenes.push_back(std::make_unique<Scene>(sceneCursor, hash, file, version));
 		}
 	}
 
-	Scene::Scene(std::ifstream& a_stream, std::string_view a_hash, uint8_t a_version) :
+	bool AnimPackage::HasEdits() const
+	{
+		return std::ranges::any_of(scenes, [](const auto& scene) { return scene->has_edits; });
+	}
+
+	void AnimPackage::ClearEdits() const
+	{
+		for (auto&& scene : scenes) {
+			scene->has_edits = false;
+		}
+	}
+
+	Scene::Scene(Decode::Cursor& a_cursor, std::string_view a_hash, const fs::path& a_source, uint8_t a_version) :
 		hash(a_hash), enabled(true)
 	{
-		id.resize(Decode::ID_SIZE);
-		a_stream.read(id.data(), Decode::ID_SIZE);
-		Decode::Read(a_stream, name);
+		id = Decode::ReadId(a_cursor, Decode::ID_SIZE, "scene.id");
+		Decode::Read(a_cursor, name, "scene.name");
 		// --- Position Infos
-		uint64_t info_count;
-		Decode::Read(a_stream, info_count);
+		const auto info_count = Decode::ReadCount(a_cursor, PositionInfo::MIN_ENCODED_SIZE, "scene.position_count");
 		positions.reserve(info_count);
 		for (size_t i = 0; i < info_count; i++) {
-			positions.emplace_back(a_stream, a_version);
+			positions.emplace_back(a_cursor, a_version);
 		}
 
 		enum legacySex : char
@@ -92,47 +127,67 @@ namespace Registry
 			}
 			return Combinatorics::CResult::Next;
 		});
-		// --- Stages
-		std::string startstage(Decode::ID_SIZE, 'X');
-		a_stream.read(startstage.data(), Decode::ID_SIZE);
-		uint64_t stage_count;
-		Decode::Read(a_stream, stage_count);
+		// --- Stages & Graph
+		const auto startstage = Decode::ReadId(a_cursor, Decode::ID_SIZE, "scene.start_stage");
+		if (Settings::bLazySceneStages) {
+			source = &a_source;
+			version = a_version;
+			start_stage = startstage;
+			stageOffset = a_cursor.GetOffset();
+			SkimStages(a_cursor, startstage, a_version);
+			stageSize = a_cursor.GetOffset() - stageOffset;
+		} else {
+			DecodeStages(a_cursor, startstage, a_version);
+			for (auto&& stage : stages) {
+				tags.AddTag(stage->tags);
+			}
+		}
+		// --- Misc
+		Decode::ReadRaw(a_cursor, &furnitureTypes, 4, "scene.furniture_types");
+		Decode::ReadRaw(a_cursor, &allowBed, 1, "scene.allow_bed");
+		furnitureOffset = Coordinate(a_cursor);
+		Decode::ReadRaw(a_cursor, &isPrivate, 1, "scene.private");
+	}
+
+	void Scene::DecodeStages(Decode::Cursor& a_cursor, std::string_view a_startstage, uint8_t a_version)
+	{
+		const auto stage_count = Decode::ReadCount(a_cursor, Stage::MIN_ENCODED_SIZE, "scene.stage_count");
 		stages.reserve(stage_count);
 		for (size_t i = 0; i < stage_count; i++) {
 			const auto& stage = stages.emplace_back(
-				std::make_unique<Stage>(a_stream, a_version));
-
-			tags.AddTag(stage->tags);
-			if (stage->id == startstage) {
+				std::make_unique<Stage>(a_cursor, a_version));
+			if (stage->id == a_startstage) {
 				start_animation = stage.get();
 			}
 		}
 		if (!start_animation) {
-			const auto err = std::format("Start animation {} is not found in scene {}", startstage, id);
+			const auto err = std::format("Start animation {} is not found in scene {}", a_startstage, id);
 			throw std::runtime_error(err.c_str());
 		}
 		// --- Graph
+		// Public lookups would try to load the stages again, which may be what is currently happening
+		const auto findStage = [this](const std::string& a_id) -> const Stage* {
+			const auto where = std::ranges::find(stages, a_id, [](auto& stage) -> const std::string& { return stage->id; });
+			return where == stages.end() ? nullptr : where->get();
+		};
 		uint64_t graph_vertices;
-		Decode::Read(a_stream, graph_vertices);
+		Decode::Read(a_cursor, graph_vertices, "scene.graph_vertex_count");
 		if (graph_vertices != stage_count) {
 			const auto err = std::format("Invalid graph vertex count; expected {} but got {}", stage_count, graph_vertices);
 			throw std::runtime_error(err.c_str());
 		}
-		std::string vertexid(Decode::ID_SIZE, 'X');
 		for (size_t i = 0; i < graph_vertices; i++) {
-			a_stream.read(vertexid.data(), Decode::ID_SIZE);
-			const auto vertex = GetStageByID(vertexid.data());
+			const auto vertexid = Decode::ReadId(a_cursor, Decode::ID_SIZE, "scene.graph_vertex");
+			const auto vertex = findStage(vertexid);
 			if (!vertex) {
 				const auto err = std::format("Invalid vertex: {} in scene: {}", vertexid, id);
 				throw std::runtime_error(err.c_str());
 			}
 			std::vector<const Stage*> edges{};
-			uint64_t edge_count;
-			Decode::Read(a_stream, edge_count);
-			std::string edgeid(Decode::ID_SIZE, 'X');
+			const auto edge_count = Decode::ReadCount(a_cursor, Decode::ID_SIZE, "scene.graph_edge_count");
 			for (size_t n = 0; n < edge_count; n++) {
-				a_stream.read(edgeid.data(), Decode::ID_SIZE);
-				const auto edge = GetStageByID(edgeid.data());
+				const auto edgeid = Decode::ReadId(a_cursor, Decode::ID_SIZE, "scene.graph_edge");
+				const auto edge = findStage(edgeid);
 				if (!edge) {
 					const auto err = std::format("Invalid edge: {} for vertex: {} in scene: {}", edgeid, vertexid, id);
 					throw std::runtime_error(err.c_str());
@@ -141,14 +196,65 @@ namespace Registry
 			}
 			graph.insert(std::make_pair(vertex, edges));
 		}
-		// --- Misc
-		a_stream.read(reinterpret_cast<char*>(&furnitureTypes), 4);
-		a_stream.read(reinterpret_cast<char*>(&allowBed), 1);
-		furnitureOffset = Coordinate(a_stream);
-		a_stream.read(reinterpret_cast<char*>(&isPrivate), 1);
 	}
 
-	PositionInfo::PositionInfo(std::ifstream& a_stream, uint8_t a_version)
+	void Scene::SkimStages(Decode::Cursor& a_cursor, std::string_view a_startstage, uint8_t a_version)
+	{
+		// Mirrors DecodeStages, only keeping the stage tags and validating the start stage and graph size
+		constexpr size_t POSITION_FIXED_SIZE = 1 + sizeof(int32_t) * CoordinateType::Total + 1;
+		const size_t positionSize = POSITION_FIXED_SIZE + (a_version >= 3 ? 1 : 0);
+		bool hasStartStage = false;
+		const auto stage_count = Decode::ReadCount(a_cursor, Stage::MIN_ENCODED_SIZE, "scene.stage_count");
+		for (size_t i = 0; i < stage_count; i++) {
+			hasStartStage |= Decode::ReadId(a_cursor, Decode::ID_SIZE, "stage.id") == a_startstage;
+			const auto position_count = Decode::ReadCount(a_cursor, Position::MIN_ENCODED_SIZE, "stage.position_count");
+			for (size_t n = 0; n < position_count; n++) {
+				Decode::SkipString(a_cursor, "position.event");
+				a_cursor.Take(positionSize, "position");
+			}
+			a_cursor.Take(sizeof(uint32_t), "stage.fixedlength");
+			Decode::SkipString(a_cursor, "stage.navtext");
+			tags.AddTag(TagData{ a_cursor });
+		}
+		if (!hasStartStage) {
+			const auto err = std::format("Start animation {} is not found in scene {}", a_startstage, id);
+			throw std::runtime_error(err.c_str());
+		}
+		const auto graph_vertices = Decode::Read<uint64_t>(a_cursor, "scene.graph_vertex_count");
+		if (graph_vertices != stage_count) {
+			const auto err = std::format("Invalid graph vertex count; expected {} but got {}", stage_count, graph_vertices);
+			throw std::runtime_error(err.c_str());
+		}
+		for (size_t i = 0; i < graph_vertices; i++) {
+			a_cursor.Take(Decode::ID_SIZE, "scene.graph_vertex");
+			const auto edge_count = Decode::ReadCount(a_cursor, Decode::ID_SIZE, "scene.graph_edge_count");
+			a_cursor.Take(Decode::ID_SIZE * edge_count, "scene.graph_edge");
+		}
+	}
+
+	void Scene::LoadStages() const
+	{
+		if (!source)
+			return;
+		std::call_once(stagesLoaded, [this]() {
+			try {
+				const auto buffer = Decode::LoadFile(*source, stageOffset, stageSize);
+				Decode::Cursor cursor{ buffer, Decode::GetFormat(version), stageOffset };
+				const_cast<Scene*>(this)->DecodeStages(cursor, start_stage, version);
+			} catch (const std::exception& e) {
+				logger::error("Failed to load stages of scene {}, disabling it: {}", id, e.what());
+				// Eager loading would have rejected this scene, drop whatever was decoded before the error
+				const auto self = const_cast<Scene*>(this);
+				self->stages.clear();
+				self->graph.clear();
+				self->start_animation = nullptr;
+				broken = true;
+			}
+			stagesDecoded = true;
+		});
+	}
+
+	PositionInfo::PositionInfo(Decode::Cursor& a_cursor, uint8_t a_version)
 	{
 		enum Extra : uint8_t
 		{
@@ -160,20 +266,19 @@ namespace Registry
 		RaceKey race;
 		REX::EnumSet<Sex> sex;
 		REX::EnumSet<Extra> extra;
-		a_stream.read(reinterpret_cast<char*>(&race), 1);
-		a_stream.read(reinterpret_cast<char*>(&sex), 1);
-		Decode::Read(a_stream, scale);
-		a_stream.read(reinterpret_cast<char*>(&extra), 1);
+		Decode::ReadRaw(a_cursor, &race, 1, "position_info.race");
+		Decode::ReadRaw(a_cursor, &sex, 1, "position_info.sex");
+		Decode::Read(a_cursor, scale, "position_info.scale");
+		Decode::ReadRaw(a_cursor, &extra, 1, "position_info.extra");
 
 		data = ActorFragment(sex, race, scale, extra.all(Extra::Vamprie), extra.all(Extra::Submissive), extra.all(Extra::Unconscious));
 
 		if (a_version > 1) {
-			uint64_t extra_custom;
-			Decode::Read(a_stream, extra_custom);
+			const auto extra_custom = Decode::ReadCount(a_cursor, sizeof(uint64_t), "position_info.annotation_count");
 			annotations.reserve(extra_custom);
 			for (size_t j = 0; j < extra_custom; j++) {
 				RE::BSFixedString tag;
-				Decode::Read(a_stream, tag);
+				Decode::Read(a_cursor, tag, "position_info.annotation");
 				annotations.push_back(tag);
 			}
 		} else {
@@ -181,35 +286,35 @@ namespace Registry
 		}
 	}
 
-	Stage::Stage(std::ifstream& a_stream, uint8_t a_version)
+	Stage::Stage(Decode::Cursor& a_cursor, uint8_t a_version)
 	{
-		id.resize(Decode::ID_SIZE);
-		a_stream.read(id.data(), Decode::ID_SIZE);
+		id = Decode::ReadId(a_cursor, Decode::ID_SIZE, "stage.id");
 
-		uint64_t position_count;
-		Decode::Read(a_stream, position_count);
+		const auto position_count = Decode::ReadCount(a_cursor, Position::MIN_ENCODED_SIZE, "stage.position_count");
 		positions.reserve(position_count);
 		for (size_t i = 0; i < position_count; i++) {
-			positions.emplace_back(a_stream, a_version);
+			positions.emplace_back(a_cursor, a_version);
 		}
-		if (a_version >= 4) {
+		if (a_version >= 5) {
+			Decode::Read(a_cursor, fixedlength, "stage.fixedlength");
+		} else if (a_version >= 4) {
 			uint32_t fixedlength_ms;
-			Decode::Read(a_stream, fixedlength_ms);
+			Decode::Read(a_cursor, fixedlength_ms, "stage.fixedlength");
 			fixedlength = static_cast<float>(fixedlength_ms) / 1000.0f;
 		} else {
-			Decode::Read(a_stream, fixedlength);
+			Decode::Read(a_cursor, fixedlength, "stage.fixedlength");
 			fixedlength /= 1000.0f;
 		}
-		Decode::Read(a_stream, navtext);
-		tags = TagData{ a_stream };
+		navtext = *Pool<std::string>::GetSingleton()->Intern(Decode::Read<std::string>(a_cursor, "stage.navtext"));
+		tags = TagData{ a_cursor };
 	}
 
-	Position::Position(std::ifstream& a_stream, uint8_t a_version) :
-		event(Decode::Read<decltype(event)>(a_stream)),
-		climax(Decode::Read<uint8_t>(a_stream) > 0),
-		offset(Transform(a_stream)),
-		strips(decltype(strips)::enum_type(Decode::Read<uint8_t>(a_stream))),
-		schlong(a_version >= 3 ? Decode::Read<decltype(schlong)>(a_stream) : 0) {}
+	Position::Position(Decode::Cursor& a_cursor, uint8_t a_version) :
+		event(Decode::Read<decltype(event)>(a_cursor, "position.event")),
+		climax(Decode::Read<uint8_t>(a_cursor, "position.climax") > 0),
+		offset(Transform(a_cursor)),
+		strips(decltype(strips)::enum_type(Decode::Read<uint8_t>(a_cursor, "position.strips"))),
+		schlong(a_version >= 3 ? Decode::Read<decltype(schlong)>(a_cursor, "position.schlong") : 0) {}
 
 	void Position::Save(YAML::Node& a_node) const
 	{
@@ -261,6 +366,9 @@ namespace Registry
 	void Scene::Save(YAML::Node& a_node) const
 	{
 		a_node["enabled"] = this->enabled;
+		// Stages that were never decoded have not been edited and their settings file had no entries for them
+		if (!HasDecodedStages())
+			return;
 		for (auto&& stage : stages) {
 			auto node = a_node[stage->id];
 			stage->Save(node);
@@ -272,6 +380,17 @@ namespace Registry
 		if (const auto enable = a_node["enabled"]; enable.IsDefined())
 			this->enabled = enable.as<bool>();
 
+		// Only decode deferred stages if this record has settings for them
+		bool hasStageSettings = false;
+		for (auto&& it : a_node) {
+			if (it.first.as<std::string>() != "enabled") {
+				hasStageSettings = true;
+				break;
+			}
+		}
+		if (!hasStageSettings)
+			return;
+		LoadStages();
 		for (auto&& stage : stages) {
 			if (auto node = a_node[stage->id]; node.IsDefined()) {
 				stage->Load(node);
@@ -279,6 +398,116 @@ namespace Registry
 		}
 	}
 
+	void Position::Save(std::ostream& a_stream) const
+	{
+		const auto& coordinate = offset.GetOffset();
+		Binary::Write<uint8_t>(a_stream, offset.HasChanges());
+		Binary::Write(a_stream, coordinate.location.x);
+		Binary::Write(a_stream, coordinate.location.y);
+		Binary::Write(a_stream, coordinate.location.z);
+		Binary::Write(a_stream, coordinate.rotation);
+		Binary::Write(a_stream, schlong);
+	}
+
+	void Position::Load(std::istream& a_stream)
+	{
+		const auto hasChanges = Binary::Read<uint8_t>(a_stream);
+		Coordinate coordinate{};
+		Binary::Read(a_stream, coordinate.location.x);
+		Binary::Read(a_stream, coordinate.location.y);
+		Binary::Read(a_stream, coordinate.location.z);
+		Binary::Read(a_stream, coordinate.rotation);
+		Binary::Read(a_stream, schlong);
+		// Unchanged offsets are not applied, so that updates to the raw offset are picked up
+		if (hasChanges) {
+			offset.SetOffset(coordinate);
+		}
+	}
+
+	void Stage::Save(std::ostream& a_stream) const
+	{
+		Binary::Write(a_stream, static_cast<uint8_t>(positions.size()));
+		for (auto&& position : positions) {
+			position.Save(a_stream);
+		}
+		const auto& annotations = tags.GetAnnotations();
+		Binary::Write(a_stream, static_cast<uint16_t>(annotations.size()));
+		for (auto&& annotation : annotations) {
+			Binary::Write(a_stream, std::string_view{ annotation.data(), annotation.size() });
+		}
+	}
+
+	bool Stage::HasSettings() const
+	{
+		return !tags.GetAnnotations().empty() || std::ranges::any_of(positions, [](const Position& position) {
+			return position.offset.HasChanges() || position.schlong != 0;
+		});
+	}
+
+	void Stage::Load(std::istream& a_stream)
+	{
+		const auto positionCount = Binary::Read<uint8_t>(a_stream);
+		for (size_t i = 0; i < positionCount; i++) {
+			if (i < positions.size()) {
+				positions[i].Load(a_stream);
+			} else {
+				a_stream.ignore(Position::BINARY_SIZE);
+			}
+		}
+		const auto annotationCount = Binary::Read<uint16_t>(a_stream);
+		for (size_t i = 0; i < annotationCount; i++) {
+			tags.AddAnnotation(Binary::Read<std::string>(a_stream));
+		}
+	}
+
+	void Scene::Save(std::ostream& a_stream) const
+	{
+		Binary::Write<uint8_t>(a_stream, this->enabled);
+		if (!HasDecodedStages()) {
+			Binary::Write<uint16_t>(a_stream, 0);
+			return;
+		}
+		std::vector<const Stage*> edited{};
+		for (auto&& stage : stages) {
+			if (stage->HasSettings()) {
+				edited.push_back(stage.get());
+			}
+		}
+		Binary::Write(a_stream, static_cast<uint16_t>(edited.size()));
+		for (auto&& stage : edited) {
+			std::ostringstream record{};
+			stage->Save(record);
+			const auto payload = record.str();
+			Binary::WriteId(a_stream, stage->id, Decode::ID_SIZE);
+			Binary::Write(a_stream, static_cast<uint32_t>(payload.size()));
+			a_stream.write(payload.data(), payload.size());
+		}
+	}
+
+	void Scene::Load(std::istream& a_stream)
+	{
+		this->enabled = Binary::Read<uint8_t>(a_stream) > 0;
+		const auto stageCount = Binary::Read<uint16_t>(a_stream);
+		if (stageCount == 0)
+			return;
+		LoadStages();
+		for (size_t i = 0; i < stageCount; i++) {
+			const auto stageId = Binary::ReadId(a_stream, Decode::ID_SIZE);
+			const auto size = Binary::Read<uint32_t>(a_stream);
+			const auto it = std::ranges::find(stages, stageId, [](auto& stage) -> const std::string& { return stage->id; });
+			if (it == stages.end()) {
+				a_stream.ignore(size);
+				continue;
+			}
+			auto record = Binary::ReadRecord(a_stream, size);
+			try {
+				(*it)->Load(record);
+			} catch (const std::exception& e) {
+				logger::warn("Scene {}: Skipping malformed settings of stage {}: {}", id, (*it)->id, e.what());
+			}
+		}
+	}
+
 
 	bool PositionInfo::CanFillPosition(RE::Actor* a_actor) const
 	{
@@ -336,6 +565,7 @@ namespace Registry
 
 	Stage* Scene::GetStageByID(const RE::BSFixedString& a_key)
 	{
+		LoadStages();
 		if (a_key.empty()) {
 			return start_animation;
 		}
@@ -345,6 +575,7 @@ namespace Registry
 
 	const Stage* Scene::GetStageByID(const RE::BSFixedString& a_key) const
 	{
+		LoadStages();
 		if (a_key.empty()) {
 			return start_animation;
 		}
@@ -374,7 +605,7 @@ namespace Registry
 
 	bool Scene::IsEnabled() const
 	{
-		return enabled;
+		return enabled && !broken;
 	}
 
 	bool Scene::IsPrivate() const
@@ -492,12 +723,13 @@ namespace Registry
 			return {};
 
 		const auto N = a_fragments.size();
+		const auto scoreTable = ActorFragment::GetScoreTable();
 		std::vector fragmentGraph(N, std::vector<std::pair<size_t, int32_t>>{});	 // fragment[i] = { { positionIdx, score }, ... }
 		for (size_t i = 0; i < N; i++) {
 			const auto& fragment = a_fragments[i];
 			for (size_t j = 0; j < N; j++) {
 				const auto& position = positions[j];
-				const auto score = position.data.GetCompatibilityScore(fragment);
+				const auto score = position.data.GetCompatibilityScore(fragment, *scoreTable);
 				if (score > 0) {
 					fragmentGraph[i].emplace_back(j, score);
 				}
@@ -563,6 +795,7 @@ namespace Registry
 
 	size_t Scene::GetNumAdjacentStages(const Stage* a_stage) const
 	{
+		LoadStages();
 		const auto where = graph.find(a_stage);
 		if (where == graph.end())
 			return 0;
@@ -572,6 +805,7 @@ namespace Registry
 
 	const Stage* Scene::GetNthAdjacentStage(const Stage* a_stage, size_t n) const
 	{
+		LoadStages();
 		const auto where = graph.find(a_stage);
 		if (where == graph.end())
 			return 0;
@@ -584,6 +818,7 @@ namespace Registry
 
 	const std::vector<const Stage*>* Scene::GetAdjacentStages(const Stage* a_stage) const
 	{
+		LoadStages();
 		const auto where = graph.find(a_stage);
 		return where != graph.end() ? &where->second : nullptr;
 	}
@@ -603,11 +838,13 @@ namespace Registry
 
 	size_t Scene::GetNumStages() const
 	{
+		LoadStages();
 		return stages.size();
 	}
 
 	const std::vector<const Stage*> Scene::GetAllStages() const
 	{
+		LoadStages();
 		std::vector<const Stage*> ret{};
 		ret.reserve(stages.size());
 		for (auto&& stage : stages) {
@@ -618,6 +855,7 @@ namespace Registry
 
 	Scene::NodeType Scene::GetStageNodeType(const Stage* a_stage) const
 	{
+		LoadStages();
 		if (a_stage == start_animation)
 			return NodeType::Root;
 
@@ -692,6 +930,7 @@ namespace Registry
 
 	void Scene::ForEachStage(std::function<bool(Stage*)> a_visitor)
 	{
+		LoadStages();
 		for (auto&& stage : stages) {
 			if (a_visitor(stage.get())) {
 				return;
@@ -701,6 +940,7 @@ namespace Registry
 
 	std::vector<const Stage*> Scene::GetEndingStages() const
 	{
+		LoadStages();
 		std::vector<const Stage*> ret{};
 		for (auto&& [vert, edges] : graph) {
 			if (edges.empty()) {
@@ -712,6 +952,7 @@ namespace Registry
 
 	std::vector<const Stage*> Scene::GetClimaxStages() const
 	{
+		LoadStages();
 		std::vector<const Stage*> ret{};
 		for (auto&& stage : stages) {
 			for (auto&& position : stage->positions) {
@@ -726,6 +967,7 @@ namespace Registry
 
 	std::vector<const Stage*> Scene::GetFixedLengthStages() const
 	{
+		LoadStages();
 		std::vector<const Stage*> ret{};
 		for (auto&& stage : stages) {
 			if (stage->fixedlength)
@@ -26,12 +26,19 @@ namespace Registry
 			All = static_cast<std::underlying_type_t<StripData>>(-1),
 		};
 
+		// Size of a single position record in binary scene settings: flag, offset, schlong
+		static constexpr size_t BINARY_SIZE{ sizeof(uint8_t) + sizeof(float) * CoordinateType::Total + sizeof(int8_t) };
+		// Event, climax, offset and strips; the smallest a position can be in an .slr file
+		static constexpr size_t MIN_ENCODED_SIZE{ sizeof(uint64_t) + sizeof(uint8_t) + sizeof(int32_t) * CoordinateType::Total + sizeof(uint8_t) };
+
 	public:
-		Position(std::ifstream& a_stream, uint8_t a_version);
+		Position(Decode::Cursor& a_cursor, uint8_t a_version);
 		~Position() = default;
 
 		void Save(YAML::Node& a_node) const;
 		void Load(const YAML::Node& a_node);
+		void Save(std::ostream& a_stream) const;
+		void Load(std::istream& a_stream);
 
 	public:
 		RE::BSFixedString event;
@@ -44,25 +51,35 @@ namespace Registry
 
 	struct Stage
 	{
+		// Id, position count, fixed length, navtext and tag count
+		static constexpr size_t MIN_ENCODED_SIZE{ Decode::ID_SIZE + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t) };
+
 	public:
-		Stage(std::ifstream& a_stream, uint8_t a_version);
+		Stage(Decode::Cursor& a_cursor, uint8_t a_version);
 		~Stage() = default;
 
 		void Save(YAML::Node& a_node) const;
 		void Load(const YAML::Node& a_node);
+		void Save(std::ostream& a_stream) const;
+		void Load(std::istream& a_stream);
+		/// @brief If this stage holds anything worth writing to the user settings
+		_NODISCARD bool HasSettings() const;
 
 	public:
 		std::string id;
 		std::vector<Position> positions;
 
 		float fixedlength;
-		std::string navtext;
+		std::string_view navtext;	 // Interned, always null-terminated
 		TagData tags;
 	};
 
 	struct PositionInfo
 	{
-		PositionInfo(std::ifstream& a_stream, uint8_t a_version);
+		// Race, sex, scale and extra
+		static constexpr size_t MIN_ENCODED_SIZE{ sizeof(uint8_t) + sizeof(uint8_t) + sizeof(int32_t) + sizeof(uint8_t) };
+
+		PositionInfo(Decode::Cursor& a_cursor, uint8_t a_version);
 		~PositionInfo() = default;
 
 		_NODISCARD bool IsHuman() const { return data.IsHuman(); }
@@ -98,7 +115,7 @@ namespace Registry
 		};
 
 	public:
-		Scene(std::ifstream& a_stream, std::string_view a_hash, uint8_t a_version);
+		Scene(Decode::Cursor& a_cursor, std::string_view a_hash, const fs::path& a_source, uint8_t a_version);
 		~Scene() = default;
 
 		_NODISCARD bool IsEnabled() const;
@@ -140,6 +157,8 @@ namespace Registry
 
 		void Save(YAML::Node& a_node) const;
 		void Load(const YAML::Node& a_node);
+		void Save(std::ostream& a_stream) const;
+		void Load(std::istream& a_stream);
 
 	public:
 		// If the animation only includes humans, with specified amount of males and females
@@ -150,11 +169,19 @@ namespace Registry
 		std::string id;
 		std::string name;
 		bool enabled;
+		mutable bool has_edits{ false };
 
 		std::vector<PositionInfo> positions;
 		Transform furnitureOffset;
 		TagData tags;
 
+	private:
+		void DecodeStages(Decode::Cursor& a_cursor, std::string_view a_startstage, uint8_t a_version);
+		void SkimStages(Decode::Cursor& a_cursor, std::string_view a_startstage, uint8_t a_version);
+		/// @brief Decode stages and graph on first access, if they were skipped when the package was loaded
+		void LoadStages() const;
+		_NODISCARD bool HasDecodedStages() const { return !source || stagesDecoded; }
+
 	private:
 		std::string_view hash;
 
@@ -164,7 +191,17 @@ namespace Registry
 
 		std::vector<std::unique_ptr<Stage>> stages;
 		std::map<const Stage*, std::vector<const Stage*>> graph;
-		Stage* start_animation;
+		Stage* start_animation{ nullptr };
+
+		// Lazy stage loading, source is only set if stages and graph are deferred until first access
+		const fs::path* source{ nullptr };
+		std::string start_stage;
+		size_t stageOffset{ 0 };
+		size_t stageSize{ 0 };
+		uint8_t version{ 0 };
+		mutable std::once_flag stagesLoaded;
+		mutable std::atomic<bool> stagesDecoded{ false };
+		mutable std::atomic<bool> broken{ false };	// Deferred stages failed to decode, the scene is treated as disabled
 	};
 
 	class AnimPackage
@@ -177,10 +214,15 @@ namespace Registry
 		RE::BSFixedString GetAuthor() const { return author; }
 		std::string_view GetHash() const { return hash; }
 
+		/// @brief If any scene in this package has been edited since the last time its settings were written
+		_NODISCARD bool HasEdits() const;
+		void ClearEdits() const;
+
 	public:
 		std::vector<std::unique_ptr<Scene>> scenes;
 
 	private:
+		fs::path file;
 		RE::BSFixedString name;
 		RE::BSFixedString author;
 		std::string hash;
@@ -23,6 +23,7 @@ namespace Registry
 				std::copy_n(values.begin(), it.size(), it.begin());
 			}
 		}
+		UpdateScaledData();
 	}
 
 	Expression::Expression(const nlohmann::json& a_src) :
@@ -67,6 +68,7 @@ namespace Registry
 				if (get(tag))
 					tags.AddTag(tag);
 		}
+		UpdateScaledData();
 	}
 
 	Expression::Expression(DefaultExpression a_default) :
@@ -165,26 +167,48 @@ namespace Registry
 			assert(false);
 			break;
 		}
+		UpdateScaledData();
 	}
 
 	std::array<float, Expression::ValueType::Total> Expression::GetData(RE::SEXES::SEX a_sex, float a_strength) const
 	{
-		if (version < 1) {
-			if (data[a_sex].empty()) {
+		if (!IsValidData(a_sex)) {
+			if (version < 1) {
 				logger::error("Invalid Expression Profile, {}: No data found", id);
-				auto ret = std::array<float, Total>{};
-				ret[MoodType] = 7;
-				return ret;
+			} else {
+				logger::error("Invalid Expression Profile, {}: {}/2 Profiles present", id, data[a_sex].size());
 			}
+		}
+		const auto level = static_cast<size_t>(std::lround(std::clamp(a_strength, 0.0f, 100.0f)));
+		return scaledData[a_sex][level];
+	}
+
+	size_t Expression::GetScaledDataSize() const
+	{
+		size_t ret = 0;
+		for (auto&& table : scaledData) {
+			ret += table.capacity() * sizeof(std::array<float, Total>);
+		}
+		return ret;
+	}
+
+	bool Expression::IsValidData(RE::SEXES::SEX a_sex) const
+	{
+		return version < 1 ? !data[a_sex].empty() : data[a_sex].size() == 2;
+	}
+
+	std::array<float, Expression::ValueType::Total> Expression::ComputeData(RE::SEXES::SEX a_sex, float a_strength) const
+	{
+		if (!IsValidData(a_sex)) {
+			auto ret = std::array<float, Total>{};
+			ret[MoodType] = 7;
+			return ret;
+		}
+		if (version < 1) {
 			const auto max = static_cast<float>(data[a_sex].size()) - 1;
 			const auto idx = static_cast<size_t>(std::floor((max * a_strength) / 100));
 			assert(idx < data[a_sex].size() && idx >= 0);
 			return data[a_sex][idx];
-		} else if (data[a_sex].size() != 2) {
-			logger::error("Invalid Expression Profile, {}: {}/2 Profiles present", id, data[a_sex].size());
-			auto ret = std::array<float, Total>{};
-			ret[MoodType] = 7;
-			return ret;
 		}
 		float multiplier;
 		switch (scaling) {
@@ -224,6 +248,17 @@ namespace Registry
 		return ret;
 	}
 
+	void Expression::UpdateScaledData()
+	{
+		for (size_t sex = 0; sex < RE::SEXES::kTotal; sex++) {
+			auto& table = scaledData[sex];
+			table.resize(STRENGTH_LEVELS);
+			for (size_t level = 0; level < STRENGTH_LEVELS; level++) {
+				table[level] = ComputeData(static_cast<RE::SEXES::SEX>(sex), static_cast<float>(level));
+			}
+		}
+	}
+
 	void Expression::Save(std::string_view a_fileLocation, bool force) const
 	{
 		if (!has_edits && !force) return;
@@ -257,6 +292,7 @@ namespace Registry
 			dataEntry.emplace_back();
 		}
 		std::copy_n(a_values.begin(), dataEntry[a_level].size(), dataEntry[a_level].begin());
+		UpdateScaledData();
 	}
 
 	void Expression::UpdateTags(const TagData& a_newtags)
@@ -269,6 +305,7 @@ namespace Registry
 	{
 		has_edits = true;
 		scaling = a_scaling;
+		UpdateScaledData();
 	}
 
 	void Expression::SetEnabled(bool a_enabled)
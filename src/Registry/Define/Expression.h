@@ -38,8 +38,11 @@ namespace Registry
 			Total = 32
 		};
 
+		static constexpr size_t STRENGTH_LEVELS = 101;	 // Integer strengths [0, 100]
+
 	public:
-		Expression(const RE::BSFixedString& a_id) : id(a_id) { assert(!a_id.empty()); };
+		Expression(const RE::BSFixedString& a_id) :
+			id(a_id) { assert(!a_id.empty()); UpdateScaledData(); }
 		Expression(DefaultExpression a_default);
 		Expression(const YAML::Node& a_src);
 		Expression(const nlohmann::json& a_src);
@@ -49,7 +52,11 @@ namespace Registry
 		RE::BSFixedString GetId() const { return id; }
 		RE::BSFixedString GetName() const { return id; }
 		const TagData& GetTags() const { return tags; }
+		/// @brief The values at the given strength, rounded to the nearest integer strength
+		/// @note Not synchronized with edits, use Library::GetExpressionData for expressions owned by the Library
 		std::array<float, Total> GetData(RE::SEXES::SEX a_sex, float a_strength) const;
+		/// @brief Bytes held by the precomputed strength tables, STRENGTH_LEVELS * Total * sizeof(float) per sex
+		_NODISCARD size_t GetScaledDataSize() const;
 
 		void UpdateValues(bool a_female, int a_level, std::vector<float> a_values);
 		void UpdateTags(const TagData& a_newtags);
@@ -67,6 +74,15 @@ namespace Registry
 		TagData tags{};
 		Scaling scaling{ Scaling::Linear };
 		std::vector<std::array<float, Total>> data[RE::SEXES::kTotal]{};
+
+	private:
+		_NODISCARD bool IsValidData(RE::SEXES::SEX a_sex) const;
+		_NODISCARD std::array<float, Total> ComputeData(RE::SEXES::SEX a_sex, float a_strength) const;
+		void UpdateScaledData();
+
+		// Values at every integer strength, rebuilt in place whenever data or scaling change
+		// 101 * 32 * 4 = 12928 bytes per sex, about 26 KB per expression for RE::SEXES::kTotal = 2
+		std::vector<std::array<float, Total>> scaledData[RE::SEXES::kTotal]{};
 	};
 
 }	 // namespace Registry
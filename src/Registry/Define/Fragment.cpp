@@ -1,6 +1,8 @@
 #include "Fragment.h"
 
+#include "Registry/Util/FragmentCache.h"
 #include "Registry/Util/Scale.h"
+#include "Registry/Define/ActorProfile.h"
 #include "Registry/Define/Sex.h"
 
 namespace Registry
@@ -38,18 +40,31 @@ namespace Registry
 	}
 
 	ActorFragment::ActorFragment(RE::Actor* a_actor, bool a_submissive) :
-		actor(a_actor), value(Value::None), scale(Scale::GetSingleton()->GetScale(a_actor))
+		ActorFragment(FragmentCache::GetSingleton()->GetFragment(a_actor))
 	{
-		const auto sex = Registry::GetSex(a_actor);
+		actor = a_actor;
+		if (a_actor->IsDead() || a_actor->IsUnconscious() || a_actor->GetActorValue(RE::ActorValue::kVariable05) < 0)
+			value.set(Unconscious);
+		if (a_submissive) {
+			value.set(Submissive);
+		}
+	}
+
+	ActorFragment ActorFragment::MakeStaticFragment(RE::Actor* a_actor, const ActorProfile& a_profile)
+	{
+		ActorFragment ret{};
+		ret.actor = a_actor;
+		ret.scale = Scale::GetSingleton()->GetScale(a_actor);
+		const auto sex = Registry::GetSex(a_actor, a_profile);
 		switch (sex) {
 		case Sex::Female:
-			value.set(Female);
+			ret.value.set(Female);
 			break;
 		case Sex::Male:
-			value.set(Male);
+			ret.value.set(Male);
 			break;
 		case Sex::Futa:
-			value.set(Futa);
+			ret.value.set(Futa);
 			break;
 		default:
 			throw std::runtime_error(std::format("Cannt build fragment from Actor {:X}: Invalid Sex: {}", a_actor->GetFormID(), std::to_underlying(sex)));
@@ -59,20 +74,16 @@ namespace Registry
 		case RaceKey::None:
 			throw std::runtime_error(std::format("Cannt build fragment from Actor {:X}: Invalid RaceKey", a_actor->GetFormID()));
 		case RaceKey::Human:
-			value.set(Human);
+			ret.value.set(Human);
 			if (a_actor->HasKeywordWithType(RE::DEFAULT_OBJECT::kKeywordVampire)) {
-				value.set(Vampire);
+				ret.value.set(Vampire);
 			}
 			break;
 		default:
-			value.set(RaceKeyToValue(race));
+			ret.value.set(RaceKeyToValue(race));
 			break;
 		}
-		if (a_submissive, a_actor->IsDead() || a_actor->IsUnconscious() || a_actor->GetActorValue(RE::ActorValue::kVariable05) < 0)
-			value.set(Unconscious);
-		if (a_submissive) {
-			value.set(Submissive);
-		}
+		return ret;
 	}
 
 	RaceKey ActorFragment::GetRace() const
@@ -96,30 +107,31 @@ namespace Registry
 		return ret;
 	}
 
-	int32_t ActorFragment::GetCompatibilityScore(const ActorFragment& a_fragment) const
+	// Race and sex dependent part of the compatibility score, std::nullopt if the races are incompatible
+	static std::optional<int32_t> GetPartialScore(const ActorFragment& a_position, const ActorFragment& a_fragment)
 	{
 		int32_t score = 0;
-		const auto raceKey = GetRace();
+		const auto raceKey = a_position.GetRace();
 		const auto raceKeyIn = a_fragment.GetRace();
 		switch (raceKey) {
 		case RaceKey::Canine:
 			if (!raceKeyIn.IsAnyOf(raceKey.value, RaceKey::Dog, RaceKey::Wolf, RaceKey::Fox))
-				return 0;
+				return std::nullopt;
 			break;
 		case RaceKey::BoarAny:
 			if (!raceKeyIn.IsAnyOf(raceKey.value, RaceKey::BoarSingle, RaceKey::BoarMounted))
-				return 0;
+				return std::nullopt;
 			break;
 		case RaceKey::Human:
-			if (IsVampire() == a_fragment.IsVampire())
+			if (a_position.IsVampire() == a_fragment.IsVampire())
 				score += Settings::iWeightVampire;
 			__fallthrough;
 		default:
 			if (raceKeyIn != raceKey)
-				return 0;
+				return std::nullopt;
 			break;
 		}
-		const auto sex = GetSex();
+		const auto sex = a_position.GetSex();
 		const auto sexIn = a_fragment.GetSex();
 		if (sex.any(sexIn.get())) {
 			score += Settings::iWeightSexStrict;
@@ -128,6 +140,57 @@ namespace Registry
 		} else {
 			score += Settings::iWeightSexMismatch;
 		}
+		return score;
+	}
+
+	ActorFragment::ScoreTable::ScoreTable() :
+		weights({ Settings::iWeightVampire, Settings::iWeightSexStrict, Settings::iWeightSexLight, Settings::iWeightSexMismatch }),
+		scores(1ULL << (KEY_BITS * 2))
+	{
+		for (ValueType position = 0; position <= KEY_MASK; position++) {
+			const ActorFragment positionFragment{ REX::EnumSet<Value>{ Value(position) } };
+			for (ValueType fragment = 0; fragment <= KEY_MASK; fragment++) {
+				const auto score = GetPartialScore(positionFragment, ActorFragment{ REX::EnumSet<Value>{ Value(fragment) } });
+				scores[(position << KEY_BITS) | fragment] = score ?
+					static_cast<int16_t>(std::clamp<int32_t>(*score, INCOMPATIBLE + 1, std::numeric_limits<int16_t>::max())) :
+					INCOMPATIBLE;
+			}
+		}
+	}
+
+	bool ActorFragment::ScoreTable::IsCurrent() const
+	{
+		return weights == std::array{ Settings::iWeightVampire, Settings::iWeightSexStrict, Settings::iWeightSexLight, Settings::iWeightSexMismatch };
+	}
+
+	std::optional<int32_t> ActorFragment::ScoreTable::Get(const ActorFragment& a_position, const ActorFragment& a_fragment) const
+	{
+		const auto score = scores[((a_position.value.underlying() & KEY_MASK) << KEY_BITS) | (a_fragment.value.underlying() & KEY_MASK)];
+		return score == INCOMPATIBLE ? std::nullopt : std::optional<int32_t>{ score };
+	}
+
+	std::shared_ptr<const ActorFragment::ScoreTable> ActorFragment::GetScoreTable()
+	{
+		static std::atomic<std::shared_ptr<const ScoreTable>> table{};
+		auto ret = table.load();
+		if (!ret || !ret->IsCurrent()) {
+			ret = std::make_shared<const ScoreTable>();
+			table.store(ret);
+		}
+		return ret;
+	}
+
+	int32_t ActorFragment::GetCompatibilityScore(const ActorFragment& a_fragment) const
+	{
+		return GetCompatibilityScore(a_fragment, *GetScoreTable());
+	}
+
+	int32_t ActorFragment::GetCompatibilityScore(const ActorFragment& a_fragment, const ScoreTable& a_table) const
+	{
+		const auto partial = a_table.Get(*this, a_fragment);
+		if (!partial)
+			return 0;
+		int32_t score = *partial;
 		score += (IsUnconscious() == a_fragment.IsUnconscious() ? 1 : -1) * Settings::iWeightUnconscious;
 		score += (IsSubmissive() == a_fragment.IsSubmissive() ? 1 : -1) * Settings::iWeightSubmissive;
 		if (std::abs(scale - a_fragment.scale) <= Settings::fScaleTolerance) {
@@ -215,6 +278,20 @@ namespace Registry
 		return ret;
 	}
 
+	std::vector<ActorFragment> ActorFragment::SplitFragmentHash(const FragmentHash& a_hash)
+	{
+		constexpr FragmentHash FRAGMENT_MASK{ (1ULL << MAX_FRAGMENT_BITS) - 1 };
+		std::vector<ActorFragment> ret{};
+		for (size_t i = 0; i < MAX_ACTOR_COUNT; i++) {
+			const auto shift = (MAX_ACTOR_COUNT - 1 - i) * MAX_FRAGMENT_BITS;
+			const auto value = static_cast<ValueType>(((a_hash >> shift) & FRAGMENT_MASK).to_ullong());
+			if (value != Value::None) {
+				ret.emplace_back(REX::EnumSet<Value>{ Value(value) });
+			}
+		}
+		return ret;
+	}
+
 	std::vector<ActorFragment> ActorFragment::MakeFragmentList(std::vector<RE::Actor*> a_actors, std::vector<RE::Actor*> a_submissives)
 	{
 		std::vector<ActorFragment> fragments;
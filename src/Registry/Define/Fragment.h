@@ -39,6 +39,27 @@ namespace Registry
 		using ValueType = std::underlying_type_t<Value>;
 		using FragmentHash = std::bitset<MAX_ACTOR_COUNT * MAX_FRAGMENT_BITS>;
 
+		/// @brief Race and sex dependent part of GetCompatibilityScore for every pair of fragments, built from the Settings weights
+		class ScoreTable
+		{
+			static constexpr size_t KEY_BITS = 9;	 // Sex and race bits, the remaining flags are cheap to score directly
+			static constexpr ValueType KEY_MASK = (1 << KEY_BITS) - 1;
+			static constexpr int16_t INCOMPATIBLE = std::numeric_limits<int16_t>::min();
+
+		public:
+			ScoreTable();
+			~ScoreTable() = default;
+
+			/// @brief If the table was built with the weights currently set in Settings
+			_NODISCARD bool IsCurrent() const;
+			/// @return The partial score, or std::nullopt if the fragment can never fill the position
+			_NODISCARD std::optional<int32_t> Get(const ActorFragment& a_position, const ActorFragment& a_fragment) const;
+
+		private:
+			std::array<int32_t, 4> weights;
+			std::vector<int16_t> scores;
+		};
+
 	public:
 		ActorFragment() = default;
 		ActorFragment(REX::EnumSet<Sex> a_sex, RaceKey a_race, float a_scale, bool a_vampire, bool a_submissive, bool a_unconscious);
@@ -46,7 +67,12 @@ namespace Registry
 		ActorFragment(RE::Actor* a_actor, bool a_submissive);
 		~ActorFragment() = default;
 
+		/// @brief Build the sex, race and scale part of the fragment, without consulting the FragmentCache
+		/// @throws std::runtime_error if the actor has no valid sex or race
+		_NODISCARD static ActorFragment MakeStaticFragment(RE::Actor* a_actor, const ActorProfile& a_profile);
+
 		_NODISCARD RE::Actor* GetActor() const { return actor; }
+		_NODISCARD ValueType GetValue() const { return value.underlying(); }
 		_NODISCARD float GetScale() const { return scale; }
 		_NODISCARD RaceKey GetRace() const;
 		_NODISCARD REX::EnumSet<Sex> GetSex() const;
@@ -64,6 +90,9 @@ namespace Registry
 		/// @param a_fragment The fragment to check compatibility with.
 		/// @return An integer representing the compatibility score. A higher score indicates better compatibility. 0 indicates no compatibility.
 		_NODISCARD int32_t GetCompatibilityScore(const ActorFragment& a_fragment) const;
+		_NODISCARD int32_t GetCompatibilityScore(const ActorFragment& a_fragment, const ScoreTable& a_table) const;
+		/// @brief The score table for the current Settings weights, rebuilt if any of them changed since the last call
+		_NODISCARD static std::shared_ptr<const ScoreTable> GetScoreTable();
 
 		/// @brief Abstract fragments may represent multiple distinct actors, so we need to split them into separate fragments.
 		/// @return A vector of fragments, each representing a distinct data instance.
@@ -75,6 +104,11 @@ namespace Registry
 		/// @return A FragmentHash representing the combined attributes of the input fragments.
 		/// @note The order of the fragments does not matter, as the hash is designed to be independent of the order of the input fragments.
 		static FragmentHash MakeFragmentHash(std::vector<ActorFragment> a_fragments);
+
+		/// @brief Inverse of MakeFragmentHash.
+		/// @param a_hash A hash created by MakeFragmentHash.
+		/// @return The abstract fragments the hash was built from, in sorted order.
+		static std::vector<ActorFragment> SplitFragmentHash(const FragmentHash& a_hash);
 		
 		/// @brief QoL function to convert a vector of actors to a vector of ActorFragment objects.
 		/// @param a_actors A vector of RE::Actor pointers to be converted.
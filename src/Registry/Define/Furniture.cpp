@@ -1,6 +1,7 @@
 #include "Furniture.h"
 
 #include "Registry/Util/RayCast.h"
+#include "Registry/Util/PlacementCache.h"
 #include "Registry/Util/RayCast/ObjectBound.h"
 #include "Util/StringUtil.h"
 
@@ -151,6 +152,19 @@ namespace Registry
 	}
 
 	std::vector<FurnitureOffset> FurnitureDetails::GetCoordinatesInBound(RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter) const
+	{
+		const auto cache = PlacementCache::GetSingleton();
+		if (auto cached = cache->Find(this, a_ref, a_filter)) {
+			return std::move(*cached);
+		}
+		auto ret = SweepCoordinatesInBound(a_ref, a_filter);
+		if (a_ref->Get3D()) {
+			cache->Insert(this, a_ref, a_filter, ret);
+		}
+		return ret;
+	}
+
+	std::vector<FurnitureOffset> FurnitureDetails::SweepCoordinatesInBound(RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter) const
 	{
 		if (a_ref->GetAngleX() > Settings::fFurnitureTiltTolerance || a_ref->GetAngleY() > Settings::fFurnitureTiltTolerance) {
 			logger::error("GetCoordinatesInBound: Reference {} is tilted too much. X: {}, Y: {}", a_ref->GetFormID(), a_ref->GetAngleX(), a_ref->GetAngleY());
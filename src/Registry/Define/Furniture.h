@@ -95,6 +95,7 @@ namespace Registry
 			data({ { a_type, a_coordinate } }) {}
 		~FurnitureDetails() = default;
 
+		/// @brief All offsets matching the filter which are not obstructed on this reference, results are cached per reference
 		std::vector<FurnitureOffset> GetCoordinatesInBound(RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter) const;
 		std::vector<FurnitureOffset> GetClosestCoordinatesInBound(RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter, RE::TESObjectREFR* a_center) const;
 
@@ -119,6 +120,9 @@ namespace Registry
 			return ret;
 		}
 
+	private:
+		std::vector<FurnitureOffset> SweepCoordinatesInBound(RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter) const;
+
 	private:
 		std::vector<FurnitureOffset> data;
 	};
@@ -64,13 +64,23 @@ namespace Registry
 	RaceKey::RaceKey(RE::Actor* a_actor) :
 		RaceKey(a_actor->GetRace(), [&]() { auto base = a_actor->GetActorBase(); return base ? base->GetSex() : RE::SEXES::kMale; }()) {}
 
-	RaceKey::RaceKey(const RE::BSFixedString& a_raceStr) :
-		value(magic_enum::enum_cast<Value>(a_raceStr, magic_enum::case_insensitive).value_or(Value::None))
+	// Lowercase enum and legacy names -> RaceKey, enum names take precedence
+	static inline const std::unordered_map<std::string, RaceKey::Value> RaceKeyNames = []() {
+		std::unordered_map<std::string, RaceKey::Value> ret{};
+		for (auto&& [value, name] : magic_enum::enum_entries<RaceKey::Value>()) {
+			if (value != RaceKey::None)
+				ret.emplace(Util::CastLower(std::string{ name }), value);
+		}
+		for (auto&& [value, name] : LegacyRaceKeys) {
+			ret.try_emplace(Util::CastLower(std::string{ name }), value);
+		}
+		return ret;
+	}();
+
+	RaceKey::RaceKey(const RE::BSFixedString& a_raceStr)
 	{
-		if (value != Value::None)
-			return;
-		const auto where = std::ranges::find_if(LegacyRaceKeys, [&](const auto& pair) { return pair.second == a_raceStr; });
-		value = (where == LegacyRaceKeys.end()) ? Value::None : where->first;
+		const auto where = RaceKeyNames.find(Util::CastLower(std::string{ a_raceStr.c_str() }));
+		value = where == RaceKeyNames.end() ? Value::None : where->second;
 	}
 
 	RaceKey::RaceKey(const RE::TESRace* a_race, RE::SEXES::SEX a_sex)
@@ -176,24 +186,6 @@ namespace Registry
 		return where != LegacyRaceKeys.end() ? where->second : "";
 	}
 
-	bool RaceKey::IsCompatibleWith(RaceKey a_other) const
-	{
-		switch (value) {
-		case Value::Canine:
-			return a_other.IsAnyOf(Canine, Dog, Wolf);
-		case Value::BoarAny:
-			return a_other.IsAnyOf(BoarAny, BoarSingle, BoarMounted);
-		case Value::Dog:
-		case Value::Wolf:
-			return a_other.IsAnyOf(Canine, value);
-		case Value::BoarSingle:
-		case Value::BoarMounted:
-			return a_other.IsAnyOf(BoarAny, value);
-		default:
-			return a_other.value == value;
-		}
-	}
-
 	RaceKey RaceKey::GetMetaRace() const
 	{
 		switch (value) {
@@ -66,6 +66,8 @@ namespace Registry
 			None = static_cast<std::underlying_type_t<Value>>(-1),
 		};
 
+		static constexpr size_t COUNT = static_cast<size_t>(Value::Wolf) + 1;
+
 		constexpr RaceKey() = default;
 		constexpr RaceKey(Value a_value) :
 			value(a_value) {}
@@ -75,7 +77,7 @@ namespace Registry
 
 		_NODISCARD RaceKey GetMetaRace() const;
 		_NODISCARD RE::BSFixedString AsString() const;
-		_NODISCARD bool IsCompatibleWith(RaceKey a_other) const;
+		_NODISCARD constexpr bool IsCompatibleWith(RaceKey a_other) const;
 
 		template <typename... T>
 		_NODISCARD constexpr bool IsAnyOf(T... a_values) const
@@ -100,4 +102,42 @@ namespace Registry
 		Value value{ Value::None };
 	};
 
+	/// @brief Row i has bit j set if race key i can be animated by race key j
+	inline constexpr std::array<uint64_t, RaceKey::COUNT> RaceKeyCompatibility = []() {
+		static_assert(RaceKey::COUNT <= 64);
+		using enum RaceKey::Value;
+		const auto bit = [](RaceKey::Value a_value) { return 1ULL << a_value; };
+		std::array<uint64_t, RaceKey::COUNT> ret{};
+		for (size_t i = 0; i < RaceKey::COUNT; i++) {
+			const auto value = static_cast<RaceKey::Value>(i);
+			switch (value) {
+			case Canine:
+				ret[i] = bit(Canine) | bit(Dog) | bit(Wolf);
+				break;
+			case BoarAny:
+				ret[i] = bit(BoarAny) | bit(BoarSingle) | bit(BoarMounted);
+				break;
+			case Dog:
+			case Wolf:
+				ret[i] = bit(Canine) | bit(value);
+				break;
+			case BoarSingle:
+			case BoarMounted:
+				ret[i] = bit(BoarAny) | bit(value);
+				break;
+			default:
+				ret[i] = bit(value);
+				break;
+			}
+		}
+		return ret;
+	}();
+
+	constexpr bool RaceKey::IsCompatibleWith(RaceKey a_other) const
+	{
+		if (value >= COUNT || a_other.value >= COUNT)
+			return value == a_other.value;
+		return (RaceKeyCompatibility[value] >> a_other.value) & 1;
+	}
+
 }	 // namespace Registry
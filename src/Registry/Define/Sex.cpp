@@ -1,10 +1,42 @@
 #include "Sex.h"
 
+#include "ActorProfile.h"
 #include "Util/StringUtil.h"
 
 namespace Registry
 {
-  Sex GetSex(RE::Actor* a_actor, bool a_skipfactions)
+	template <class F>
+	static Sex GetBaseSex(RE::Actor* a_actor, F a_isfuta)
+	{
+		const auto base = a_actor->GetActorBase();
+		if (!base) {
+			logger::error("Unable to retrieve actor base for actor {:X}", a_actor->formID);
+			return Sex::None;
+		}
+		switch (base->GetSex()) {
+		default:
+		case RE::SEXES::kMale:
+			return Sex::Male;
+		case RE::SEXES::kFemale:
+			if (!a_actor->IsHumanoid()) {
+				return Settings::bCreatureGender ? Sex::Female : Sex::Male;
+			}
+			return a_isfuta() ? Sex::Futa : Sex::Female;
+		}
+	}
+
+	static bool HasSchlongSkin(RE::Actor* a_actor)
+	{
+		static const auto tngkeyword = RE::TESForm::LookupByEditorID<RE::BGSKeyword>("TNG_SkinWithPenis");
+		if (tngkeyword) {
+			if (auto skin = a_actor->GetSkin(); skin && skin->HasKeyword(tngkeyword)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	Sex GetSex(RE::Actor* a_actor, bool a_skipfactions)
 	{
 		Sex ret = Sex::None;
 		if (!a_skipfactions) {
@@ -32,33 +64,22 @@ namespace Registry
 				return ret;
 			}
 		}
+		return GetBaseSex(a_actor, [a_actor]() { return IsFuta(a_actor); });
+	}
 
-		const auto base = a_actor->GetActorBase();
-		if (!base) {
-			logger::error("Unable to retrieve actor base for actor {:X}", a_actor->formID);
-			return Sex::None;
-		}
-		switch (base->GetSex()) {
-		default:
-		case RE::SEXES::kMale:
-			return Sex::Male;
-		case RE::SEXES::kFemale:
-			if (!a_actor->IsHumanoid()) {
-				return Settings::bCreatureGender ? Sex::Female : Sex::Male;
-			}
-			return IsFuta(a_actor) ? Sex::Futa : Sex::Female;
+	Sex GetSex(RE::Actor* a_actor, const ActorProfile& a_profile, bool a_skipfactions)
+	{
+		if (!a_skipfactions && a_profile.sexOverride != Sex::None) {
+			return a_profile.sexOverride;
 		}
+		return GetBaseSex(a_actor, [&]() { return IsFuta(a_actor, a_profile); });
 	}
 
 	bool IsFuta(RE::Actor* a_actor)
 	{
-		static const auto tngkeyword = RE::TESForm::LookupByEditorID<RE::BGSKeyword>("TNG_SkinWithPenis");
-		if (tngkeyword) {
-			if (auto skin = a_actor->GetSkin(); skin && skin->HasKeyword(tngkeyword)) {
-				return true;
-			}
+		if (HasSchlongSkin(a_actor)) {
+			return true;
 		}
-
 		static const auto sosfaction = RE::TESDataHandler::GetSingleton()->LookupForm<RE::TESFaction>(0x00AFF8, "Schlongs of Skyrim.esp");
 		if (sosfaction) {
 			bool ret = false;
@@ -84,7 +105,11 @@ namespace Registry
 			return ret;
 		}
 		return false;
+	}
 
+	bool IsFuta(RE::Actor* a_actor, const ActorProfile& a_profile)
+	{
+		return HasSchlongSkin(a_actor) || a_profile.schlongified;
 	}
 
 } // namespace Registry
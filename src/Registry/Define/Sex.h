@@ -31,9 +31,13 @@ namespace Registry
 		None
 	};
 
+	struct ActorProfile;
+
 	/// @brief Get the (1 dimensional) sex for this actor
 	Sex GetSex(RE::Actor* a_actor, bool a_skipfactions = false);
+	Sex GetSex(RE::Actor* a_actor, const ActorProfile& a_profile, bool a_skipfactions = false);
 	/// @brief If this (female) actor is a futa
 	bool IsFuta(RE::Actor* a_actor);
+	bool IsFuta(RE::Actor* a_actor, const ActorProfile& a_profile);
 
 }	 // namespace Registry
@@ -1,5 +1,8 @@
 #include "Tags.h"
 
+#include <list>
+#include <mutex>
+
 #include "Registry/Util/Decode.h"
 #include "Util/StringUtil.h"
 
@@ -73,13 +76,12 @@ namespace Registry
 
 #undef MAPENTRY
 
-	TagData::TagData(std::ifstream& a_stream)
+	TagData::TagData(Decode::Cursor& a_cursor)
 	{
-		uint64_t tag_count;
-		Decode::Read(a_stream, tag_count);
+		const auto tag_count = Decode::ReadCount(a_cursor, sizeof(uint64_t), "tags.count");
 		for (size_t j = 0; j < tag_count; j++) {
 			RE::BSFixedString tag;
-			Decode::Read(a_stream, tag);
+			Decode::Read(a_cursor, tag, "tags.tag");
 			AddTag(tag);
 		}
 	}
@@ -161,12 +163,12 @@ namespace Registry
 	{
 		if (a_all) {
 			return _basetags.all(a_tag._basetags.get()) &&
-						 std::ranges::all_of(a_tag._extratags, [&](const auto& tag) { return HasTag(tag); }) &&
+						 std::ranges::all_of(a_tag._extratags, [&](const auto& tag) { return HasNonBaseTag(tag); }) &&
 						 std::ranges::all_of(a_tag._annotations, [&](const auto& tag) { return HasTag(tag); });
 		} else {
 			if (_basetags.any(a_tag._basetags.get())) return true;
 			if (a_tag._extratags.empty() && a_tag._annotations.empty()) return true;
-			return std::ranges::any_of(a_tag._extratags, [&](const auto& tag) { return HasTag(tag); }) ||
+			return std::ranges::any_of(a_tag._extratags, [&](const auto& tag) { return HasNonBaseTag(tag); }) ||
 						 std::ranges::any_of(a_tag._annotations, [&](const auto& tag) { return HasTag(tag); });
 		}
 	}
@@ -233,12 +235,62 @@ namespace Registry
 		return std::find(_extratags.begin(), _extratags.end(), a_tag) != _extratags.end();
 	}
 
+	bool TagData::HasNonBaseTag(const RE::BSFixedString& a_tag) const
+	{
+		return HasExtraTag(a_tag) || HasAnnotation(a_tag);
+	}
+
 	TagDetails::TagDetails(const std::string_view a_tags) :
-		TagDetails(Util::StringSplit(a_tags, ",")) {}
+		_tags(Compile(a_tags)) {}
+
+	TagDetails::TagDetails(const std::vector<std::string_view> a_tags) :
+		_tags(Compile(Util::StringJoin(a_tags, ","))) {}
+
+	TagDetails::TagDetails(const std::array<TagData, TagType::Total> a_tags) :
+		_tags(std::make_shared<const Compiled>(Compiled{ a_tags })) {}
+
+	std::shared_ptr<const TagDetails::Compiled> TagDetails::Compile(std::string_view a_tags)
+	{
+		using Entry = std::pair<std::string, std::shared_ptr<const Compiled>>;
+		static std::mutex _m{};
+		static std::list<Entry> recent{};	 // Most recently used first
+		static std::unordered_map<std::string_view, std::list<Entry>::iterator> lookup{};	 // Keys view into recent
+
+		{
+			std::scoped_lock lock{ _m };
+			const auto where = lookup.find(a_tags);
+			if (where != lookup.end()) {
+				recent.splice(recent.begin(), recent, where->second);
+				return where->second->second;
+			}
+		}
+		auto compiled = std::make_shared<const Compiled>(Parse(a_tags));
+		std::scoped_lock lock{ _m };
+		if (lookup.contains(a_tags)) {
+			return compiled;
+		}
+		recent.emplace_front(std::string{ a_tags }, compiled);
+		lookup.emplace(recent.front().first, recent.begin());
+		if (recent.size() > PARSE_CACHE_SIZE) {
+			lookup.erase(recent.back().first);
+			recent.pop_back();
+		}
+		return compiled;
+	}
 
-	TagDetails::TagDetails(const std::vector<std::string_view> a_tags)
+	TagDetails::Compiled TagDetails::Parse(std::string_view a_tags)
 	{
-		for (auto&& tag : a_tags) {
+		Compiled ret{};
+		if (TagExpression::IsExpression(a_tags)) {
+			try {
+				ret.expression.emplace(a_tags);
+			} catch (const std::exception& e) {
+				logger::error("Invalid tag expression '{}': {}", a_tags, e.what());
+				ret.invalid = true;
+			}
+			return ret;
+		}
+		for (auto&& tag : Util::StringSplit(a_tags, ",")) {
 			if (tag.empty())
 				continue;
 
@@ -246,31 +298,163 @@ namespace Registry
 			case '!':	 // Scene Meta for Papyrus, ignore
 				continue;
 			case '~':
-				_tags[TagType::Optional].AddTag(std::string(tag.substr(1)));
+				ret.tags[TagType::Optional].AddTag(std::string(tag.substr(1)));
 				break;
 			case '-':
-				_tags[TagType::Disallow].AddTag(std::string(tag.substr(1)));
+				ret.tags[TagType::Disallow].AddTag(std::string(tag.substr(1)));
 				break;
 			default:
-				_tags[TagType::Required].AddTag(std::string(tag));
+				ret.tags[TagType::Required].AddTag(std::string(tag));
 				break;
 			}
 		}
-	}
-
-	TagDetails::TagDetails(const std::array<TagData, TagType::Total> a_tags)
-	{
-		for (size_t i = 0; i < TagType::Total; i++)
-			_tags[i] = a_tags[i];
+		return ret;
 	}
 
 	bool TagDetails::MatchTags(const TagData& a_data) const
 	{
-		if (!_tags[TagType::Disallow].IsEmpty() && a_data.HasTags(_tags[TagType::Disallow], false))
+		if (_tags->invalid)
 			return false;
-		if (!_tags[TagType::Optional].IsEmpty() && !a_data.HasTags(_tags[TagType::Optional], false))
+		if (_tags->expression)
+			return _tags->expression->Evaluate(a_data);
+		const auto& tags = _tags->tags;
+		if (!tags[TagType::Disallow].IsEmpty() && a_data.HasTags(tags[TagType::Disallow], false))
 			return false;
-		return _tags[TagType::Required].IsEmpty() || a_data.HasTags(_tags[TagType::Required], true);
+		if (!tags[TagType::Optional].IsEmpty() && !a_data.HasTags(tags[TagType::Optional], false))
+			return false;
+		return tags[TagType::Required].IsEmpty() || a_data.HasTags(tags[TagType::Required], true);
+	}
+
+	static void SkipSpace(std::string_view& a_in)
+	{
+		while (!a_in.empty() && std::isspace(static_cast<unsigned char>(a_in.front())))
+			a_in.remove_prefix(1);
+	}
+
+	bool TagExpression::IsExpression(std::string_view a_tags)
+	{
+		return a_tags.find_first_of("()|&") != std::string_view::npos;
+	}
+
+	TagExpression::TagExpression(std::string_view a_expression)
+	{
+		auto in = a_expression;
+		ParseOr(in, 0);
+		SkipSpace(in);
+		if (!in.empty())
+			throw std::runtime_error(std::format("Unexpected '{}' at position {}", in.front(), a_expression.size() - in.size()));
+
+		size_t depth = 0;
+		for (auto&& instruction : _code) {
+			switch (instruction.op) {
+			case Op::Base:
+			case Op::Extra:
+				if (++depth > MAX_DEPTH)
+					throw std::runtime_error(std::format("Expression exceeds the maximum depth of {}", MAX_DEPTH));
+				break;
+			case Op::And:
+			case Op::Or:
+				depth--;
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void TagExpression::ParseOr(std::string_view& a_in, size_t a_depth)
+	{
+		ParseAnd(a_in, a_depth);
+		for (SkipSpace(a_in); !a_in.empty() && a_in.front() == '|'; SkipSpace(a_in)) {
+			a_in.remove_prefix(1);
+			ParseAnd(a_in, a_depth);
+			_code.push_back({ Op::Or });
+		}
+	}
+
+	void TagExpression::ParseAnd(std::string_view& a_in, size_t a_depth)
+	{
+		ParseUnary(a_in, a_depth);
+		for (SkipSpace(a_in); !a_in.empty() && (a_in.front() == '&' || a_in.front() == ','); SkipSpace(a_in)) {
+			a_in.remove_prefix(1);
+			ParseUnary(a_in, a_depth);
+			_code.push_back({ Op::And });
+		}
+	}
+
+	void TagExpression::ParseUnary(std::string_view& a_in, size_t a_depth)
+	{
+		if (a_depth > MAX_DEPTH)
+			throw std::runtime_error(std::format("Expression exceeds the maximum depth of {}", MAX_DEPTH));
+		SkipSpace(a_in);
+		if (a_in.empty())
+			throw std::runtime_error("Unexpected end of expression");
+		switch (a_in.front()) {
+		case '!':
+		case '-':
+			a_in.remove_prefix(1);
+			ParseUnary(a_in, a_depth + 1);
+			_code.push_back({ Op::Not });
+			return;
+		case '(':
+			a_in.remove_prefix(1);
+			ParseOr(a_in, a_depth + 1);
+			SkipSpace(a_in);
+			if (a_in.empty() || a_in.front() != ')')
+				throw std::runtime_error("Missing ')'");
+			a_in.remove_prefix(1);
+			return;
+		case '~':
+			throw std::runtime_error("Optional tags ('~') are not supported in expressions, use '|' instead");
+		case ')':
+		case '|':
+		case '&':
+		case ',':
+			throw std::runtime_error(std::format("Expected a tag but found '{}'", a_in.front()));
+		default:
+			break;
+		}
+		auto name = a_in.substr(0, a_in.find_first_of("()|&,!"));
+		a_in.remove_prefix(name.size());
+		while (!name.empty() && std::isspace(static_cast<unsigned char>(name.back())))
+			name.remove_suffix(1);
+
+		const RE::BSFixedString tag{ std::string{ name } };
+		const auto where = TagTable.find(tag);
+		if (where != TagTable.end()) {
+			_code.push_back({ Op::Base, std::to_underlying(where->second) });
+		} else {
+			_code.push_back({ Op::Extra, _extras.size() });
+			_extras.push_back(tag);
+		}
+	}
+
+	bool TagExpression::Evaluate(const TagData& a_data) const
+	{
+		std::array<bool, MAX_DEPTH> stack;
+		size_t top = 0;
+		for (auto&& [op, operand] : _code) {
+			switch (op) {
+			case Op::Base:
+				stack[top++] = a_data.HasTag(static_cast<Tag>(operand));
+				break;
+			case Op::Extra:
+				stack[top++] = a_data.HasNonBaseTag(_extras[operand]);
+				break;
+			case Op::Not:
+				stack[top - 1] = !stack[top - 1];
+				break;
+			case Op::And:
+				top--;
+				stack[top - 1] = stack[top - 1] && stack[top];
+				break;
+			case Op::Or:
+				top--;
+				stack[top - 1] = stack[top - 1] || stack[top];
+				break;
+			}
+		}
+		return stack[0];
 	}
 
-}
\ No newline at end of file
+}
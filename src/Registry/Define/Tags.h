@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Registry/Util/Decode.h"
+
 namespace Registry
 {
 	enum class Tag : uint64_t
@@ -73,7 +75,7 @@ namespace Registry
 				AddTag(it);
 			}
 		}
-		TagData(std::ifstream& a_stream);
+		TagData(Decode::Cursor& a_cursor);
 		TagData() = default;
 		~TagData() = default;
 
@@ -99,6 +101,12 @@ namespace Registry
 		/// @brief If this data contains any tags
 		_NODISCARD bool IsEmpty() const;
 
+		/// @brief Bitmask of all base tags in this data
+		_NODISCARD uint64_t GetBaseTags() const { return _basetags.underlying(); }
+
+		/// @brief HasTag for a tag known not to be a base tag
+		_NODISCARD bool HasNonBaseTag(const RE::BSFixedString& a_tag) const;
+
 	public:
 		bool HasAnnotation(const RE::BSFixedString& a_tag) const;
 		void AddAnnotation(RE::BSFixedString a_tag);
@@ -126,6 +134,46 @@ namespace Registry
 		std::vector<RE::BSFixedString> _annotations;
 	};
 
+	/// @brief Boolean combination of tags, such as "(oral|anal) & !aggressive & (bed|floor)"
+	/// Operators are '|', '&' (or ','), '!' (or '-') and parentheses, binding from weakest to strongest in that order
+	class TagExpression
+	{
+		static constexpr size_t MAX_DEPTH = 32;
+
+		enum class Op : uint8_t
+		{
+			Base,		 // Push HasTag(operand as Tag)
+			Extra,	 // Push HasNonBaseTag(extras[operand])
+			Not,
+			And,
+			Or,
+		};
+
+		struct Instruction
+		{
+			Op op;
+			uint64_t operand{ 0 };
+		};
+
+	public:
+		/// @brief If the string uses expression syntax rather than a flat, comma separated list of tags
+		_NODISCARD static bool IsExpression(std::string_view a_tags);
+
+		/// @throws std::runtime_error if the expression is malformed or nested too deeply
+		TagExpression(std::string_view a_expression);
+		~TagExpression() = default;
+
+		_NODISCARD bool Evaluate(const TagData& a_data) const;
+
+	private:
+		void ParseOr(std::string_view& a_in, size_t a_depth);
+		void ParseAnd(std::string_view& a_in, size_t a_depth);
+		void ParseUnary(std::string_view& a_in, size_t a_depth);
+
+		std::vector<Instruction> _code;	 // Postfix
+		std::vector<RE::BSFixedString> _extras;
+	};
+
 	class TagDetails
 	{
 	public:
@@ -138,7 +186,11 @@ namespace Registry
 			Total
 		};
 
+		static constexpr size_t PARSE_CACHE_SIZE = 256;
+
 	public:
+		/// @brief Parsed queries are cached by their raw string, repeated queries share the same compiled tags
+		/// @param a_tags Either a comma separated list of tags with '~' (optional) and '-' (disallow) prefixes, or a TagExpression
 		TagDetails(const std::string_view a_tags);
 		TagDetails(const std::vector<std::string_view> a_tags);
 		TagDetails(const std::array<TagData, TagType::Total> a_tags);
@@ -148,7 +200,16 @@ namespace Registry
 		_NODISCARD bool MatchTags(const TagData& a_data) const;
 
 	private:
-		TagData _tags[TagType::Total];
+		struct Compiled
+		{
+			std::array<TagData, TagType::Total> tags{};
+			std::optional<TagExpression> expression{ std::nullopt };
+			bool invalid{ false };	// Malformed expression, matches nothing
+		};
+		_NODISCARD static std::shared_ptr<const Compiled> Compile(std::string_view a_tags);
+		_NODISCARD static Compiled Parse(std::string_view a_tags);
+
+		std::shared_ptr<const Compiled> _tags;
 	};
 
 }	 // namespace Registry
@@ -3,6 +3,7 @@
 #include <numbers>
 
 #include "Registry/Util/Decode.h"
+#include "Registry/Util/Pool.h"
 
 namespace Registry
 {
@@ -14,15 +15,15 @@ namespace Registry
 		location(a_x, a_y, a_z), rotation(a_rotation) {}
 	Coordinate::Coordinate(const std::vector<float>& a_coordinates) :
 		location(glm::vec3{ a_coordinates[0], a_coordinates[1], a_coordinates[2] }), rotation(a_coordinates[3]) {}
-	Coordinate::Coordinate(std::ifstream& a_stream) :
+	Coordinate::Coordinate(Decode::Cursor& a_cursor) :
 		location([&]() {
 			glm::vec3 ret{};
-			Decode::Read(a_stream, ret.x);
-			Decode::Read(a_stream, ret.y);
-			Decode::Read(a_stream, ret.z);
+			Decode::Read(a_cursor, ret.x, "coordinate.x");
+			Decode::Read(a_cursor, ret.y, "coordinate.y");
+			Decode::Read(a_cursor, ret.z, "coordinate.z");
 			return ret;
 		}()),
-		rotation(Decode::Read<float>(a_stream)) {}
+		rotation(Decode::Read<float>(a_cursor, "coordinate.rotation")) {}
 
 	void Coordinate::Apply(Coordinate& a_coordinate) const
 	{
@@ -43,33 +44,50 @@ namespace Registry
 		return (Apply(ret), ret);
 	}
 
+	size_t CoordinateHash::operator()(const Coordinate& a_coordinate) const
+	{
+		size_t seed = 0;
+		for (auto&& value : { a_coordinate.location.x, a_coordinate.location.y, a_coordinate.location.z, a_coordinate.rotation }) {
+			seed ^= std::hash<float>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+		return seed;
+	}
+
 	Transform::Transform(const Coordinate& a_rawoffset) :
-		_raw(a_rawoffset), _offset(a_rawoffset) {}
+		_raw(Intern(a_rawoffset)), _offset(_raw) {}
+
+	Transform::Transform(Decode::Cursor& a_cursor) :
+		Transform(Coordinate{ a_cursor }) {}
 
-	Transform::Transform(std::ifstream& a_binarystream) :
-		_raw(a_binarystream), _offset(_raw) {}
+	Transform::Transform() :
+		Transform(Coordinate{ 0.0f, 0.0f, 0.0f, 0.0f }) {}
+
+	const Coordinate* Transform::Intern(const Coordinate& a_coordinate)
+	{
+		return Pool<Coordinate, CoordinateHash>::GetSingleton()->Intern(a_coordinate);
+	}
 
 	const Coordinate& Transform::GetRawOffset() const
 	{
-		return _raw;
+		return *_raw;
 	}
 
 	const Coordinate& Transform::GetOffset() const
 	{
-		return _offset;
+		return *_offset;
 	}
 
 	float Transform::GetOffset(CoordinateType a_type) const
 	{
 		switch (a_type) {
 		case CoordinateType::X:
-			return _offset.location.x;
+			return _offset->location.x;
 		case CoordinateType::Y:
-			return _offset.location.y;
+			return _offset->location.y;
 		case CoordinateType::Z:
-			return _offset.location.z;
+			return _offset->location.z;
 		case CoordinateType::R:
-			return _offset.rotation;
+			return _offset->rotation;
 		}
 		logger::error("Invalid offset type: {}", std::to_underlying(a_type));
 		return 0.0f;
@@ -77,34 +95,35 @@ namespace Registry
 
 	void Transform::SetOffset(const Coordinate& a_newoffset)
 	{
-		_offset = a_newoffset;
+		_offset = Intern(a_newoffset);
 	}
 
 	void Transform::SetOffset(float x, float y, float z, float rot)
 	{
-		_offset.location = { x, y, z };
-		_offset.rotation = glm::radians(rot);
+		_offset = Intern(Coordinate{ x, y, z, glm::radians(rot) });
 	}
 
 	void Transform::SetOffset(float a_value, CoordinateType a_type)
 	{
+		Coordinate offset{ *_offset };
 		switch (a_type) {
 		case CoordinateType::X:
-			_offset.location.x = a_value;
+			offset.location.x = a_value;
 			break;
 		case CoordinateType::Y:
-			_offset.location.y = a_value;
+			offset.location.y = a_value;
 			break;
 		case CoordinateType::Z:
-			_offset.location.z = a_value;
+			offset.location.z = a_value;
 			break;
 		case CoordinateType::R:
-			_offset.rotation = glm::radians(a_value);
+			offset.rotation = glm::radians(a_value);
 			break;
 		default:
 			logger::error("Invalid offset type: {}", std::to_underlying(a_type));
-			break;
+			return;
 		}
+		_offset = Intern(offset);
 	}
 
 	void Transform::ResetOffset()
@@ -122,27 +141,30 @@ namespace Registry
 	void Transform::Save(YAML::Node& a_node) const
 	{
 		auto loc = a_node["Location"];
-		loc[0] = _offset.location.x;
-		loc[1] = _offset.location.y;
-		loc[2] = _offset.location.z;
+		loc[0] = _offset->location.x;
+		loc[1] = _offset->location.y;
+		loc[2] = _offset->location.z;
 
-		a_node["Rotation"] = _offset.rotation;
+		a_node["Rotation"] = _offset->rotation;
 	}
 
 	void Transform::Load(const YAML::Node& a_node)
 	{
+		Coordinate offset{ *_offset };
 		if (auto loc = a_node["Location"]; loc.IsDefined() && loc.size() == 3) {
-			_offset.location.x = loc[0].as<float>();
-			_offset.location.y = loc[1].as<float>();
-			_offset.location.z = loc[2].as<float>();
+			offset.location.x = loc[0].as<float>();
+			offset.location.y = loc[1].as<float>();
+			offset.location.z = loc[2].as<float>();
 		}
 		if (auto rot = a_node["Rotation"]; rot.IsDefined()) {
-			_offset.rotation = rot.as<float>();
+			offset.rotation = rot.as<float>();
 		}
+		_offset = Intern(offset);
 	}
 
 	bool Transform::HasChanges() const
 	{
+		// Equal values are interned to the same address
 		return _offset != _raw;
 	}
 
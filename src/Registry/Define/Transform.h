@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Registry/Util/Decode.h"
+
 namespace Registry
 {
 	enum CoordinateType : uint8_t
@@ -19,7 +21,7 @@ namespace Registry
 		Coordinate(const RE::NiPoint3& a_point, float a_rotation);
 		Coordinate(float a_x, float a_y, float a_z, float a_rotation);
 		Coordinate(const std::vector<float>& a_coordinates);
-		Coordinate(std::ifstream& a_stream);
+		Coordinate(Decode::Cursor& a_cursor);
 		~Coordinate() = default;
 
 		void Apply(Coordinate& a_coordinate) const;
@@ -38,16 +40,21 @@ namespace Registry
 		float rotation;
 	};
 
+	struct CoordinateHash
+	{
+		size_t operator()(const Coordinate& a_coordinate) const;
+	};
+
 	class Transform
 	{
 	public:
 		Transform(const Coordinate& a_rawcoordinates);
-		Transform(std::ifstream& a_binarystream);
-		Transform() = default;
+		Transform(Decode::Cursor& a_cursor);
+		Transform();
 		~Transform() = default;
 
 	public:
-		void Apply(Coordinate& a_coordinate) const { _offset.Apply(a_coordinate); }
+		void Apply(Coordinate& a_coordinate) const { _offset->Apply(a_coordinate); }
 		Coordinate ApplyReturn(const Coordinate& a_coordinate) const;
 		bool HasChanges() const;
 
@@ -63,8 +70,11 @@ namespace Registry
 		void Load(const YAML::Node& a_node);
 
 	private:
-		Coordinate _raw;
-		Coordinate _offset;
+		static const Coordinate* Intern(const Coordinate& a_coordinate);
+
+		// Both interned and shared by all identical transforms, _offset is _raw until the offset is edited
+		const Coordinate* _raw;
+		const Coordinate* _offset;
 	};
 
 }	 // namespace Registry
@@ -4,6 +4,26 @@
 
 namespace Registry
 {
+	/// @brief Visit the default set and every extra set of a voice node, in the order they are loaded into extrasets
+	template <class F>
+	static void ForEachSetNode(const YAML::Node& a_node, F a_func)
+	{
+		a_func(a_node);
+		if (const auto extra = a_node["Extra"]; extra.IsDefined()) {
+			for (auto&& it : extra) {
+				a_func(it);
+			}
+		}
+	}
+
+	template <class T>
+	static void EraseDuplicates(std::vector<T>& a_values)
+	{
+		std::ranges::sort(a_values);
+		const auto [first, last] = std::ranges::unique(a_values);
+		a_values.erase(first, last);
+	}
+
 	Voice::Voice(const YAML::Node& a_node) :
 		name(a_node["Name"].as<std::string>()),
 		displayName(a_node["DisplayName"].as<std::string>(""s)),
@@ -38,12 +58,7 @@ namespace Registry
 		defaultset(a_node),
 		extrasets([&]() {
 			decltype(extrasets) ret{};
-			ret.emplace_back(a_node);
-			auto extra = a_node["Extra"];
-			if (extra.IsDefined())
-				for (auto&& it : extra) {
-					ret.emplace_back(it);
-				}
+			ForEachSetNode(a_node, [&](const YAML::Node& a_set) { ret.emplace_back(a_set); });
 			return ret;
 		}())
 	{}
@@ -75,10 +90,30 @@ namespace Registry
 
 	RE::TESSound* Voice::PickOrgasmSound(REX::EnumSet<VoiceAnnotation> a_annotation) const
 	{
-		const auto s = GetApplicableSet(a_annotation);
+		const auto& s = GetApplicableSet(a_annotation);
 		return s.GetOrgasm() ? s.GetOrgasm() : s.Get(100);
 	}
 
+	std::vector<RE::TESSound*> Voice::GetSounds() const
+	{
+		auto ret = defaultset.GetSounds();
+		for (auto&& set : extrasets) {
+			std::ranges::copy(set.GetSounds(), std::back_inserter(ret));
+		}
+		EraseDuplicates(ret);
+		return ret;
+	}
+
+	std::vector<std::string> Voice::GetSoundIds(const YAML::Node& a_node)
+	{
+		std::vector<std::string> ret{};
+		ForEachSetNode(a_node, [&](const YAML::Node& a_set) {
+			std::ranges::copy(VoiceSet::GetSoundIds(a_set), std::back_inserter(ret));
+		});
+		EraseDuplicates(ret);
+		return ret;
+	}
+
 	void Voice::SaveToFile(std::string_view a_fileLocation) const
 	{
 		const auto path = std::format("{}\\{}.yaml", a_fileLocation, GetId());
@@ -194,6 +229,32 @@ namespace Registry
 		return nullptr;
 	}
 
+	std::vector<RE::TESSound*> VoiceSet::GetSounds() const
+	{
+		std::vector<RE::TESSound*> ret{};
+		ret.reserve(data.size() + 1);
+		for (auto&& [sound, _] : data) {
+			if (sound)
+				ret.push_back(sound);
+		}
+		if (orgasm)
+			ret.push_back(orgasm);
+		return ret;
+	}
+
+	std::vector<std::string> VoiceSet::GetSoundIds(const YAML::Node& a_node)
+	{
+		std::vector<std::string> ret{};
+		const auto v = a_node["Voices"];
+		for (auto&& it : v) {
+			ret.push_back(v.IsMap() ? it.first.as<std::string>() : it.as<std::string>());
+		}
+		if (auto o = a_node["Orgasm"]; o.IsDefined()) {
+			ret.push_back(o.as<std::string>());
+		}
+		return ret;
+	}
+
 	RE::TESSound* VoiceSet::Get(LegacyVoice a_setting) const
 	{
 		switch (a_setting) {
@@ -40,6 +40,10 @@ namespace Registry
 		RE::TESSound* GetOrgasm() const { return orgasm; }
 		RE::TESSound* Get(uint32_t a_excitement) const;
 		RE::TESSound* Get(LegacyVoice a_setting) const;
+		/// @brief Every sound this set can play, including its orgasm sound
+		std::vector<RE::TESSound*> GetSounds() const;
+		/// @brief The form ids of every sound a set node references, as written in the file. Does not resolve any forms
+		static std::vector<std::string> GetSoundIds(const YAML::Node& a_node);
 
 	public:
 		void SetSound(bool front, RE::TESSound* a_sound);
@@ -70,6 +74,10 @@ namespace Registry
 		RE::TESSound* PickSound(LegacyVoice a_legacysetting) const;
 		RE::TESSound* PickSound(uint32_t a_excitement, REX::EnumSet<VoiceAnnotation> a_annotation) const;
 		RE::TESSound* PickOrgasmSound(REX::EnumSet<VoiceAnnotation> a_annotation) const;
+		/// @brief Every sound this voice can play, across all sets, without duplicates
+		std::vector<RE::TESSound*> GetSounds() const;
+		/// @brief The prefetch set of a voice file without loading it, GetSounds() as unresolved form ids
+		static std::vector<std::string> GetSoundIds(const YAML::Node& a_node);
 
 	public:
 		void SaveToFile(std::string_view a_fileLocation) const;
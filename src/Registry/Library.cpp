@@ -29,20 +29,19 @@ namespace Registry
 		_hashbuilder.join();
 
 		const std::shared_lock lock{ _mScenes };
-		const auto where = this->scenes.find(hash);
-		if (where == this->scenes.end()) {
+		const auto rawScenes = this->scenes.Find(hash.to_ullong());
+		if (rawScenes.empty()) {
 			logger::warn("Invalid query: [{} | {} | {}]; No animations for given actors", a_actors.size(), hash.to_string(), tagstr);
 			return {};
 		}
-		const auto& rawScenes = where->second;
 
 		std::vector<const Scene*> ret{};
 		ret.reserve(rawScenes.size());
-		std::copy_if(rawScenes.begin(), rawScenes.end(), std::back_inserter(ret), [&](Scene* a_scene) {
+		std::ranges::copy_if(rawScenes, std::back_inserter(ret), [&](Scene* a_scene) {
 			return a_scene->IsEnabled() && !a_scene->IsPrivate();
 		});
 		if (ret.empty()) {
-			logger::warn("Invalid query: [{} | {} | {}]; 0/{} animations are enabled", a_actors.size(), hash.to_string(), tagstr, where->second.size());
+			logger::warn("Invalid query: [{} | {} | {}]; 0/{} animations are enabled", a_actors.size(), hash.to_string(), tagstr, rawScenes.size());
 			return {};
 		}
 		const auto removed = std::erase_if(ret, [&](const Scene* a_scene) {
@@ -58,6 +57,76 @@ namespace Registry
 		return ret;
 	}
 
+	std::vector<Library::PartialMatch> Library::LookupPartialScenes(const std::vector<RE::Actor*>& a_actors, size_t a_open, const std::vector<std::string_view>& a_tags, const std::vector<RE::Actor*>& a_submissives) const
+	{
+		if (a_open == 0) {
+			std::vector<PartialMatch> ret{};
+			for (auto&& scene : LookupScenes(a_actors, a_tags, a_submissives)) {
+				ret.push_back({ scene, {} });
+			}
+			return ret;
+		}
+		if (a_actors.empty() || a_actors.size() + a_open > ActorFragment::MAX_ACTOR_COUNT) {
+			logger::warn("Invalid partial query: [{} + {}]; Scenes support 1-{} actors", a_actors.size(), a_open, ActorFragment::MAX_ACTOR_COUNT);
+			return {};
+		}
+		const auto tStart = std::chrono::high_resolution_clock::now();
+		const auto hash = ActorFragment::MakeFragmentHash(ActorFragment::MakeFragmentList(a_actors, a_submissives));
+		TagDetails tags{ a_tags };
+
+		const std::shared_lock lock{ _mScenes };
+		const auto& index = partialScenes[a_open];
+		const auto total = index.GetOrdinals(hash.to_ullong()).size();
+		if (total == 0) {
+			logger::warn("Invalid partial query: [{} + {} | {}]; No animations for given actors", a_actors.size(), a_open, hash.to_string());
+			return {};
+		}
+		std::vector<PartialMatch> ret{};
+		ret.reserve(total);
+		for (auto&& entry : index.Find(hash.to_ullong())) {
+			const auto& [scene, open] = *entry;
+			if (!scene->IsEnabled() || scene->IsPrivate() || !scene->IsCompatibleTags(tags))
+				continue;
+			ret.push_back({ scene, ActorFragment::SplitFragmentHash(open) });
+		}
+		const auto tEnd = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> ms = tEnd - tStart;
+		logger::info("Found {}/{} matches for partial query [{} + {} | {}] in {}ms", ret.size(), total, a_actors.size(), a_open, hash.to_string(), ms.count());
+		return ret;
+	}
+
+	std::vector<uint32_t> Library::GetTagFacets(const std::vector<RE::Actor*>& a_actors, const std::vector<std::string_view>& a_tags, const std::vector<RE::Actor*>& a_submissives, const std::vector<RE::BSFixedString>& a_candidates) const
+	{
+		const auto matches = LookupScenes(a_actors, a_tags, a_submissives);
+		// Base tags are counted per bit for all scenes at once, extra tags only for the requested candidates
+		std::array<uint32_t, std::numeric_limits<uint64_t>::digits> baseCounts{};
+		std::vector<uint64_t> candidateMasks(a_candidates.size(), 0);
+		std::vector<size_t> extraCandidates{};
+		for (size_t i = 0; i < a_candidates.size(); i++) {
+			TagData probe{};
+			probe.AddTag(a_candidates[i]);
+			candidateMasks[i] = probe.GetBaseTags();
+			if (candidateMasks[i] == 0) {
+				extraCandidates.push_back(i);
+			}
+		}
+		std::vector<uint32_t> ret(a_candidates.size(), 0);
+		for (auto&& scene : matches) {
+			for (auto mask = scene->tags.GetBaseTags(); mask; mask &= mask - 1) {
+				baseCounts[std::countr_zero(mask)]++;
+			}
+			for (auto&& i : extraCandidates) {
+				ret[i] += scene->tags.HasNonBaseTag(a_candidates[i]);
+			}
+		}
+		for (size_t i = 0; i < a_candidates.size(); i++) {
+			if (candidateMasks[i]) {
+				ret[i] = baseCounts[std::countr_zero(candidateMasks[i])];
+			}
+		}
+		return ret;
+	}
+
 	std::vector<const Scene*> Library::GetByTags(int32_t a_positions, const std::vector<std::string_view>& a_tags) const
 	{
 		TagDetails tags{ a_tags };
@@ -128,6 +197,7 @@ namespace Registry
 		std::unique_lock lock{ _mScenes };
 		const auto scene = const_cast<Scene*>(a_scene);
 		a_func(scene);
+		scene->has_edits = true;
 	}
 
 	bool Library::ForEachPackage(std::function<bool(const AnimPackage*)> a_visitor) const
@@ -174,8 +244,8 @@ namespace Registry
 	const Voice* Library::GetVoice(RE::Actor* a_actor, const TagDetails& a_tags)
 	{
 		std::shared_lock lock{ _mVoice };
-		if (auto saved = GetSavedVoice(a_actor->GetFormID())) {
-			return saved;
+		if (auto saved = savedVoices.find(a_actor->GetFormID()); saved != savedVoices.end()) {
+			return saved->second;
 		}
 		const RaceKey actRace{ a_actor };
 		if (!actRace.IsValid()) {
@@ -184,30 +254,45 @@ namespace Registry
 		}
 		const auto base = a_actor->GetActorBase();
 		const auto sex = base ? base->GetSex() : RE::SEXES::kMale;
+		std::optional<Pitch> pitch{};
+		const Voice* fixedVoice = nullptr;
+		if (const auto voiceForm = base ? base->GetVoiceType() : nullptr) {
+			if (auto where = savedPitches.find(voiceForm->formID); where != savedPitches.end()) {
+				pitch = where->second.pitch;
+				fixedVoice = where->second.voice;
+			}
+		}
+		// Voices of a matching (or unknown) pitch are preferred, but any voice is used if none of them match the tags
 		std::vector<const Voice*> ret{};
-		for (auto&& [name, voice] : voices) {
-			if (!voice.enabled || voice.sex != RE::SEXES::kNone && voice.sex != sex)
-				continue;
-			if (!voice.HasRace(actRace) || !a_tags.MatchTags(voice.tags))
-				continue;
-			ret.push_back(&voice);
+		const auto collect = [&](auto&& a_filter) {
+			for (size_t i = 0; i < VOICE_PITCH_COUNT; i++) {
+				if (!a_filter(static_cast<Pitch>(i)))
+					continue;
+				for (auto&& voice : voiceBuckets[GetVoiceBucketIndex(sex, actRace, static_cast<Pitch>(i))]) {
+					if (a_tags.MatchTags(voice->tags)) {
+						ret.push_back(voice);
+					}
+				}
+			}
+		};
+		const auto isPreferred = [&](Pitch a_pitch) { return !pitch || a_pitch == Pitch::Unknown || a_pitch == *pitch; };
+		collect(isPreferred);
+		if (ret.empty() && pitch) {
+			collect(std::not_fn(isPreferred));
 		}
 		if (ret.empty())
 			return nullptr;
-		if (auto voiceForm = base->GetVoiceType()) {
-			auto where = savedPitches.find(voiceForm->formID);
-			if (where != savedPitches.end()) {
-				const auto [pitch, voice] = where->second;
-				if (voice != nullptr) return voice;
-				const auto w = std::remove_if(ret.begin(), ret.end(), [&](const auto& v) {
-					return v->pitch != Pitch::Unknown && v->pitch != pitch;
-				});
-				if (w != ret.begin() && w != ret.end()) {
-					ret.erase(w, ret.end());
-				}
-			}
+		if (fixedVoice)
+			return fixedVoice;
+		const auto voice = Random::draw(ret);
+		lock.unlock();
+		std::unique_lock writeLock{ _mVoice };
+		// Another thread may have assigned a voice to this actor while unlocked
+		const auto [where, inserted] = savedVoices.try_emplace(a_actor->formID, voice);
+		if (inserted) {
+			JournalVoice(a_actor->formID, voice);
 		}
-		return savedVoices[a_actor->formID] = Random::draw(ret);
+		return where->second;
 	}
 
 	const Voice* Library::GetVoice(const TagDetails& tags) const
@@ -234,6 +319,34 @@ namespace Registry
 		return ret.empty() ? nullptr : Random::draw(ret);
 	}
 
+	size_t Library::GetVoiceBucketIndex(RE::SEXES::SEX a_sex, RaceKey a_race, Pitch a_pitch)
+	{
+		const size_t sex = a_sex == RE::SEXES::kMale ? 0 : a_sex == RE::SEXES::kFemale ? 1 : 2;
+		assert(a_race.value < RaceKey::COUNT);
+		return (sex * RaceKey::COUNT + a_race.value) * VOICE_PITCH_COUNT + static_cast<size_t>(a_pitch);
+	}
+
+	void Library::BuildVoiceBuckets() noexcept
+	{
+		for (auto&& bucket : voiceBuckets) {
+			bucket.clear();
+		}
+		for (auto&& [name, voice] : voices) {
+			if (!voice.enabled)
+				continue;
+			for (size_t race = 0; race < RaceKey::COUNT; race++) {
+				const RaceKey key{ static_cast<RaceKey::Value>(race) };
+				if (!key.IsValid() || !voice.HasRace(key))
+					continue;
+				for (auto&& sex : { RE::SEXES::kMale, RE::SEXES::kFemale, RE::SEXES::kNone }) {
+					if (voice.sex != RE::SEXES::kNone && voice.sex != sex)
+						continue;
+					voiceBuckets[GetVoiceBucketIndex(sex, key, voice.pitch)].push_back(&voice);
+				}
+			}
+		}
+	}
+
 	const Voice* Library::GetVoiceById(RE::BSFixedString a_voice) const
 	{
 		std::shared_lock lock{ _mVoice };
@@ -249,6 +362,7 @@ namespace Registry
 			return false;
 		}
 		voices.emplace(a_voice, Voice{ a_voice });
+		voiceSettingsDirty = true;
 		return true;
 	}
 
@@ -285,15 +399,31 @@ namespace Registry
 		std::unique_lock lock{ _mVoice };
 		if (v) {
 			savedVoices.insert_or_assign(a_key, v);
-		} else {
-			savedVoices.erase(a_key);
+			JournalVoice(a_key, v);
+		} else if (savedVoices.erase(a_key)) {
+			JournalVoice(a_key, nullptr);
 		}
 	}
 
 	void Library::ClearVoice(RE::FormID a_key)
 	{
 		std::unique_lock lock{ _mVoice };
-		savedVoices.erase(a_key);
+		if (savedVoices.erase(a_key)) {
+			JournalVoice(a_key, nullptr);
+		}
+	}
+
+	void Library::JournalVoice(RE::FormID a_key, const Voice* a_voice)
+	{
+		if (voiceJournalCompact)
+			return;
+		// Once the pending changes outnumber the assignments themselves, rewriting the journal is cheaper
+		if (voiceJournalPending.size() >= std::max(savedVoices.size(), VOICE_JOURNAL_MIN_COMPACT)) {
+			voiceJournalPending.clear();
+			voiceJournalCompact = true;
+			return;
+		}
+		voiceJournalPending.emplace_back(a_key, a_voice ? a_voice->GetId() : RE::BSFixedString{});
 	}
 
 	RE::TESSound* Library::PickSound(RE::BSFixedString a_voice, LegacyVoice a_legacysetting) const
@@ -337,7 +467,9 @@ namespace Registry
 			logger::error("Voice {} not found", a_voice);
 			return;
 		}
+		voiceSettingsDirty = true;
 		v->second.enabled = a_enabled;
+		BuildVoiceBuckets();
 	}
 
 	void Library::SetVoiceSound(RE::BSFixedString a_voice, LegacyVoice a_legacysetting, RE::TESSound* a_sound)
@@ -348,6 +480,7 @@ namespace Registry
 			logger::error("Voice {} not found", a_voice);
 			return;
 		}
+		voiceSettingsDirty = true;
 		auto& voice = v->second;
 		if (voice.extrasets.empty()) {
 			logger::error("Voice {} has no extrasets", a_voice);
@@ -375,6 +508,7 @@ namespace Registry
 			logger::error("Voice {} not found", a_voice);
 			return;
 		}
+		voiceSettingsDirty = true;
 		v->second.tags.AddTag(a_tags);
 	}
 
@@ -386,6 +520,7 @@ namespace Registry
 			logger::error("Voice {} not found", a_voice);
 			return;
 		}
+		voiceSettingsDirty = true;
 		auto& voice = v->second;
 		if (!a_races.empty() && !std::ranges::contains(a_races, RaceKey::Human, [](auto& it) { return it.value; })) {
 			voice.tags.AddTag("Creature");
@@ -393,6 +528,7 @@ namespace Registry
 			voice.tags.RemoveTag("Creature");
 		}
 		voice.races = a_races;
+		BuildVoiceBuckets();
 	}
 
 	void Library::SetVoiceSex(RE::BSFixedString a_voice, RE::SEXES::SEX a_sex)
@@ -403,6 +539,7 @@ namespace Registry
 			logger::error("Voice {} not found", a_voice);
 			return;
 		}
+		voiceSettingsDirty = true;
 		auto& voice = v->second;
 		switch (a_sex) {
 		case RE::SEXES::kFemale:
@@ -419,6 +556,7 @@ namespace Registry
 			break;
 		}
 		voice.sex = a_sex;
+		BuildVoiceBuckets();
 	}
 
 	const Expression* Library::GetExpressionById(const RE::BSFixedString& a_id) const
@@ -431,13 +569,66 @@ namespace Registry
 	const Expression* Library::GetExpression(const TagDetails& a_details) const
 	{
 		std::shared_lock lock{ _mExpressions };
-		std::vector<const Expression*> ret{};
+		// Expressions sharing their tags share the match result, only match once per bucket
+		std::vector<const ExpressionBucket*> matches{};
+		size_t count = 0;
+		for (auto&& bucket : expressionBuckets) {
+			if (a_details.MatchTags(bucket.tags)) {
+				matches.push_back(&bucket);
+				count += bucket.expressions.size();
+			}
+		}
+		if (count == 0)
+			return nullptr;
+		auto i = Random::draw<size_t>(0, count - 1);
+		for (auto&& bucket : matches) {
+			if (i < bucket->expressions.size())
+				return bucket->expressions[i];
+			i -= bucket->expressions.size();
+		}
+		return nullptr;
+	}
+
+	std::array<float, Expression::Total> Library::GetExpressionData(const Expression* a_expression, RE::SEXES::SEX a_sex, float a_strength) const
+	{
+		assert(a_expression);
+		std::shared_lock lock{ _mExpressions };
+		return a_expression->GetData(a_sex, a_strength);
+	}
+
+	void Library::BuildExpressionBuckets() noexcept
+	{
+		expressionBuckets.clear();
 		for (auto&& [id, expression] : expressions) {
-			if (a_details.MatchTags(expression.GetTags())) {
-				ret.push_back(&expression);
+			AddExpressionToBuckets(&expression);
+		}
+	}
+
+	void Library::AddExpressionToBuckets(const Expression* a_expression) noexcept
+	{
+		if (!a_expression->IsEnabled())
+			return;
+		const auto& tags = a_expression->GetTags();
+		const auto where = std::ranges::find_if(expressionBuckets, [&](const ExpressionBucket& bucket) {
+			return bucket.tags.HasTags(tags, true) && tags.HasTags(bucket.tags, true);
+		});
+		if (where != expressionBuckets.end()) {
+			where->expressions.push_back(a_expression);
+		} else {
+			expressionBuckets.push_back({ tags, { a_expression } });
+		}
+	}
+
+	void Library::RemoveExpressionFromBuckets(const Expression* a_expression) noexcept
+	{
+		for (auto it = expressionBuckets.begin(); it != expressionBuckets.end(); it++) {
+			if (std::erase(it->expressions, a_expression) == 0)
+				continue;
+			if (it->expressions.empty()) {
+				expressionBuckets.erase(it);
 			}
+			return;
 		}
-		return ret.empty() ? nullptr : Random::draw(ret);
 	}
 
 	bool Library::ForEachExpression(std::function<bool(const Expression&)> a_func) const
@@ -458,7 +649,8 @@ namespace Registry
 			logger::error("Expression {} has already been initialized", a_id);
 			return false;
 		}
-		expressions.emplace(a_id, Expression{ a_id });
+		const auto [where, _] = expressions.emplace(a_id, Expression{ a_id });
+		AddExpressionToBuckets(&where->second);
 		return true;
 	}
 
@@ -481,7 +673,9 @@ namespace Registry
 			logger::error("Expression {} not found", a_id);
 			return;
 		}
+		RemoveExpressionFromBuckets(&w->second);
 		w->second.UpdateTags(a_newtags);
+		AddExpressionToBuckets(&w->second);
 	}
 
 	void Library::SetExpressionScaling(RE::BSFixedString a_id, Expression::Scaling a_scaling)
@@ -503,7 +697,9 @@ namespace Registry
 			logger::error("Expression {} not found", a_id);
 			return;
 		}
+		RemoveExpressionFromBuckets(&w->second);
 		w->second.SetEnabled(a_enabled);
+		AddExpressionToBuckets(&w->second);
 	}
 
 	const FurnitureDetails* Library::GetFurnitureDetails(const RE::TESObjectREFR* a_ref) const
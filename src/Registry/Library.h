@@ -7,6 +7,7 @@
 #include "Define/Expression.h"
 #include "Define/Fragment.h"
 #include "Define/Furniture.h"
+#include "Util/HashBuckets.h"
 
 namespace Registry
 {
@@ -14,19 +15,39 @@ namespace Registry
 	{
 		static constexpr const char* SCENE_PATH{ CONFIGPATH("Registry") };
 		static constexpr const char* SCENE_USER_CONFIG{ USER_CONFIGS("Scenes") };
+		static constexpr std::string_view SCENE_USER_BINARY_EXT{ ".slsb" };
+		static constexpr std::string_view SCENE_USER_BINARY_MAGIC{ "SLSB" };
+		static constexpr uint8_t SCENE_USER_BINARY_VERSION{ 1 };
 
 		static constexpr const char* VOICE_PATH{ CONFIGPATH("Voices\\Voices") };
 		static constexpr const char* VOICE_PATH_PITCH{ CONFIGPATH("Voices\\Pitch") };
 		static constexpr const char* VOICE_SETTING_PATH{ USER_CONFIGS("Voices.yaml") };
 		static constexpr const char* VOICE_SETTINGS_CACHES_PATH{ USER_CONFIGS("Voices_NPC.yaml") };
+		static constexpr const char* VOICE_JOURNAL_PATH{ USER_CONFIGS("Voices_NPC.slvj") };
+		static constexpr std::string_view VOICE_JOURNAL_MAGIC{ "SLVJ" };
+		static constexpr uint8_t VOICE_JOURNAL_VERSION{ 1 };
+		static constexpr size_t VOICE_JOURNAL_MIN_COMPACT{ 256 };	 // Journal records before a compaction is considered
 
 		static constexpr const char* EXPRESSION_PATH{ USER_CONFIGS("Expressions") };
 		static constexpr const char* EXPRESSION_LEGACY_CONFIG{ "Data\\SKSE\\Plugins\\SexLab\\" };
 
 		static constexpr const char* FURNITURE_PATH{ CONFIGPATH("Furniture") };
 
+	public:
+		struct PartialMatch
+		{
+			const Scene* scene;
+			std::vector<ActorFragment> open;	// Positions left to fill, one fragment per position
+		};
+
 	public:
 		_NODISCARD std::vector<const Scene*> LookupScenes(const std::vector<RE::Actor*>& a_actors, const std::vector<std::string_view>& tags, const std::vector<RE::Actor*>& a_submissives) const;
+		/// @brief Find scenes in which the given actors fill some positions and exactly a_open positions remain
+		/// @return One match per scene and distinct set of open position fragments
+		_NODISCARD std::vector<PartialMatch> LookupPartialScenes(const std::vector<RE::Actor*>& a_actors, size_t a_open, const std::vector<std::string_view>& tags, const std::vector<RE::Actor*>& a_submissives) const;
+		/// @brief For each candidate tag, the number of scenes matching the query that also have that tag
+		/// @return Counts in the order of a_candidates
+		_NODISCARD std::vector<uint32_t> GetTagFacets(const std::vector<RE::Actor*>& a_actors, const std::vector<std::string_view>& tags, const std::vector<RE::Actor*>& a_submissives, const std::vector<RE::BSFixedString>& a_candidates) const;
 		_NODISCARD std::vector<const Scene*> GetByTags(int32_t a_positions, const std::vector<std::string_view>& a_tags) const;
 
 		_NODISCARD const AnimPackage* GetPackageFromScene(const Scene* a_scene) const;
@@ -67,6 +88,8 @@ namespace Registry
 	public:
 		_NODISCARD const Expression* GetExpressionById(const RE::BSFixedString& a_id) const;
 		_NODISCARD const Expression* GetExpression(const TagDetails& a_details) const;
+		/// @brief Copy of the expression's values at a_strength, taken under the expression lock so concurrent edits cannot tear it
+		_NODISCARD std::array<float, Expression::Total> GetExpressionData(const Expression* a_expression, RE::SEXES::SEX a_sex, float a_strength) const;
 		bool ForEachExpression(std::function<bool(const Expression&)> a_visitor) const;
 		bool CreateExpression(const RE::BSFixedString& a_id);
 
@@ -79,13 +102,49 @@ namespace Registry
 		_NODISCARD const FurnitureDetails* GetFurnitureDetails(const RE::TESObjectREFR* a_ref) const;
 
 	public:
+		struct SaveStatistics
+		{
+			size_t files{ 0 };
+			size_t bytes{ 0 };
+		};
+
 		void Initialize() noexcept;
 		void Save() const noexcept;
+		_NODISCARD SaveStatistics GetSceneSaveStatistics() const;
+		/// @brief Diagnostic summary of the registry: bucket distribution, combinatorial expansion, container memory and load times
+		_NODISCARD nlohmann::json GetRegistryReport() const;
+
+	private:
+		enum class VoiceJournalOp : uint8_t
+		{
+			Save = 0,
+			Clear = 1,
+		};
+
+		struct VoiceJournalEntry
+		{
+			RE::FormID id;
+			RE::BSFixedString voice;	// Empty if cleared
+		};
+
+		struct PartialEntry
+		{
+			Scene* scene;
+			ActorFragment::FragmentHash open;
+
+			bool operator==(const PartialEntry& a_other) const { return scene == a_other.scene && open == a_other.open; }
+			bool operator<(const PartialEntry& a_other) const
+			{
+				return scene != a_other.scene ? scene < a_other.scene : open.to_ullong() < a_other.open.to_ullong();
+			}
+		};
 
 	private:
 		bool FolderExists(const char* path, bool notifyUser) const noexcept;
 		void InitializeScenes() noexcept;
 		void InitializeSceneSettings() noexcept;
+		void LoadSceneSettingsYaml(const fs::path& a_file, bool a_migrate);
+		void LoadSceneSettingsBinary(const fs::path& a_file, bool a_migrate);
 		void InitializeFurnitures() noexcept;
 		void InitializeExpressions() noexcept;
 		void InitializeExpressionsImpl() noexcept;
@@ -95,24 +154,51 @@ namespace Registry
 		void InitializeVoicePitches() noexcept;
 		void InitializeVoiceSettings() noexcept;
 		void InitializeVoiceCache() noexcept;
+		void LoadVoiceJournal() noexcept;
+		void JournalVoice(RE::FormID a_key, const Voice* a_voice);
+		void BuildVoiceBuckets() noexcept;
+		void BuildExpressionBuckets() noexcept;
+		void AddExpressionToBuckets(const Expression* a_expression) noexcept;
+		void RemoveExpressionFromBuckets(const Expression* a_expression) noexcept;
+		_NODISCARD static size_t GetVoiceBucketIndex(RE::SEXES::SEX a_sex, RaceKey a_race, Pitch a_pitch);
 
 		void SaveScenes() const noexcept;
 		void SaveExpressions() const noexcept;
 		void SaveVoices() const noexcept;
+		void SaveVoiceJournal() const noexcept;
 
 	private:
 		mutable std::shared_mutex _mScenes{};
 		std::vector<std::unique_ptr<AnimPackage>> packages;
 		std::map<RE::BSFixedString, Scene*, FixedStringCompare> sceneMap;							// SceneId -> Scene
-		std::unordered_map<ActorFragment::FragmentHash, std::vector<Scene*>> scenes;	// Hashes -> Scenes
+		HashBuckets<Scene> scenes;	// Hashes -> Scenes
+		std::vector<PartialEntry> partialEntries;	// Every distinct (scene, open fragments) pair, sorted. Referenced by partialScenes
+		std::array<HashBuckets<const PartialEntry>, ActorFragment::MAX_ACTOR_COUNT> partialScenes;	// Open Positions -> Subset Hashes -> PartialEntries
+		mutable std::atomic<size_t> sceneFilesWritten{ 0 };	 // Last save only
+		mutable std::atomic<size_t> sceneBytesWritten{ 0 };	 // Last save only
+		std::map<std::string_view, double> initializerTimes{};	// Initializer -> Milliseconds
 
 		mutable std::shared_mutex _mVoice{};
 		std::map<RE::BSFixedString, Voice, FixedStringCompare> voices{};
 		std::map<RE::FormID, VoicePitch> savedPitches{};	 // VoiceType -> Pitch (or fixed Voice)
 		std::map<RE::FormID, const Voice*> savedVoices{};	 // NPC -> Voice
+		mutable std::vector<VoiceJournalEntry> voiceJournalPending{};	 // Changes to savedVoices not yet written to the journal
+		mutable size_t voiceJournalRecords{ 0 };											 // Records currently in the journal file
+		mutable bool voiceJournalCompact{ false };										 // Rewrite the journal from savedVoices on next save
+		mutable std::atomic<bool> voiceSettingsDirty{ false };
+		mutable std::mutex _mVoiceJournal{};
+		static constexpr size_t VOICE_SEX_COUNT = 3;	// Male, Female, None
+		static constexpr size_t VOICE_PITCH_COUNT = magic_enum::enum_count<Pitch>();
+		std::array<std::vector<const Voice*>, VOICE_SEX_COUNT * RaceKey::COUNT * VOICE_PITCH_COUNT> voiceBuckets{};	// (Sex, RaceKey, Pitch) -> Enabled Voices
 
 		mutable std::shared_mutex _mExpressions{};
 		std::map<RE::BSFixedString, Expression, FixedStringCompare> expressions{};
+		struct ExpressionBucket
+		{
+			TagData tags;
+			std::vector<const Expression*> expressions;
+		};
+		std::vector<ExpressionBucket> expressionBuckets{};	// Enabled Expressions, grouped by identical tags
 
 		mutable std::shared_mutex _mFurniture{};
 		FurnitureDetails offsetDefaultBedroll{ FurnitureType::BedRoll, Coordinate(std::vector{ 0.0f, 0.0f, 7.5f, 180.0f }) };
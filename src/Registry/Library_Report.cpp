@@ -0,0 +1,113 @@
+#include "Library.h"
+
+namespace Registry
+{
+	// Rough per-node bookkeeping of the standard containers, excluding heap memory owned by the elements themselves
+	static constexpr size_t MAP_NODE_OVERHEAD = 4 * sizeof(void*);
+
+	template <class Map>
+	static size_t EstimateMapMemory(const Map& a_map)
+	{
+		return a_map.size() * (sizeof(typename Map::value_type) + MAP_NODE_OVERHEAD);
+	}
+
+	nlohmann::json Library::GetRegistryReport() const
+	{
+		constexpr size_t LARGEST_BUCKET_COUNT = 10;
+		nlohmann::json report{};
+		std::shared_lock lock{ _mScenes };
+
+		// --- Buckets
+		std::map<size_t, size_t> histogram{};	 // Scenes per bucket -> Number of buckets
+		std::vector<std::pair<uint64_t, size_t>> largest{};
+		std::unordered_map<const Scene*, size_t> memberships{};
+		scenes.ForEachBucket([&](uint64_t a_hash, std::span<const uint32_t> a_ordinals) {
+			histogram[a_ordinals.size()]++;
+			largest.emplace_back(a_hash, a_ordinals.size());
+			for (auto&& ordinal : a_ordinals) {
+				memberships[scenes.GetElement(ordinal)]++;
+			}
+		});
+		const auto n = std::min(largest.size(), LARGEST_BUCKET_COUNT);
+		std::ranges::partial_sort(largest, largest.begin() + n, std::ranges::greater{}, [](auto& it) { return it.second; });
+		largest.resize(n);
+
+		auto& buckets = report["buckets"];
+		buckets["count"] = scenes.size();
+		buckets["capacity"] = scenes.capacity();
+		buckets["histogram"] = nlohmann::json::object();
+		for (auto&& [size, count] : histogram) {
+			buckets["histogram"][std::to_string(size)] = count;
+		}
+		buckets["largest"] = nlohmann::json::array();
+		for (auto&& [hash, size] : largest) {
+			buckets["largest"].push_back({ { "hash", std::format("{:X}", hash) }, { "scenes", size } });
+		}
+
+		// --- Packages
+		auto& packageReport = report["packages"];
+		packageReport = nlohmann::json::array();
+		for (auto&& package : packages) {
+			size_t entries = 0;
+			for (auto&& scene : package->scenes) {
+				const auto where = memberships.find(scene.get());
+				entries += where == memberships.end() ? 0 : where->second;
+			}
+			const auto sceneCount = package->scenes.size();
+			packageReport.push_back({
+				{ "name", package->GetName().data() },
+				{ "hash", std::string{ package->GetHash() } },
+				{ "scenes", sceneCount },
+				{ "bucketEntries", entries },
+				{ "expansion", sceneCount ? static_cast<double>(entries) / sceneCount : 0.0 },
+			});
+		}
+		lock.unlock();
+
+		// --- Memory
+		auto& memory = report["memory"];
+		{
+			std::shared_lock sceneLock{ _mScenes };
+			memory["sceneMap"] = EstimateMapMemory(sceneMap);
+			memory["scenes"] = scenes.GetMemoryUsage();
+			size_t partialMemory = partialEntries.capacity() * sizeof(PartialEntry);
+			for (auto&& index : partialScenes) {
+				partialMemory += index.GetMemoryUsage();
+			}
+			memory["partialScenes"] = partialMemory;
+		}
+		{
+			std::shared_lock voiceLock{ _mVoice };
+			size_t bucketMemory = sizeof(voiceBuckets);
+			for (auto&& bucket : voiceBuckets) {
+				bucketMemory += bucket.capacity() * sizeof(const Voice*);
+			}
+			memory["voices"] = EstimateMapMemory(voices) + EstimateMapMemory(savedPitches) + EstimateMapMemory(savedVoices) + bucketMemory;
+		}
+		{
+			std::shared_lock expressionLock{ _mExpressions };
+			size_t bucketMemory = expressionBuckets.capacity() * sizeof(ExpressionBucket);
+			for (auto&& bucket : expressionBuckets) {
+				bucketMemory += bucket.expressions.capacity() * sizeof(const Expression*);
+			}
+			size_t tableMemory = 0;
+			for (auto&& [id, expression] : expressions) {
+				tableMemory += expression.GetScaledDataSize();
+			}
+			memory["expressions"] = EstimateMapMemory(expressions) + bucketMemory;
+			memory["expressionTables"] = tableMemory;
+		}
+		{
+			std::shared_lock furnitureLock{ _mFurniture };
+			memory["furnitures"] = EstimateMapMemory(furnitures) + furnitures.size() * sizeof(FurnitureDetails);
+		}
+
+		// --- Load Times
+		auto& times = report["loadTimeMs"];
+		for (auto&& [initializer, ms] : initializerTimes) {
+			times[std::string{ initializer }] = ms;
+		}
+		return report;
+	}
+
+}	 // namespace Registry
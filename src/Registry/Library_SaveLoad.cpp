@@ -1,5 +1,8 @@
 #include "Library.h"
 
+#include "Registry/Util/Binary.h"
+#include "Registry/Util/Decode.h"
+#include "Registry/Util/Pool.h"
 #include "Util/Combinatorics.h"
 #include "Util/StringUtil.h"
 
@@ -9,32 +12,47 @@ namespace Registry
 	{
 		logger::info("Loading Library");
 		const auto tStart = std::chrono::high_resolution_clock::now();
+		const auto timed = [](auto a_func, double& a_out) {
+			const auto start = std::chrono::high_resolution_clock::now();
+			a_func();
+			a_out = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		};
+		std::array<double, 4> times{};
 #ifndef SKYRIMVR
 		std::array threads{
-			std::thread{ [this]() { InitializeScenes(); } },
-			std::thread{ [this]() { InitializeVoice(); } },
-			std::thread{ [this]() { InitializeExpressions(); } },
-			std::thread{ [this]() { InitializeFurnitures(); } }
+			std::thread{ [&]() { timed([this]() { InitializeScenes(); }, times[0]); } },
+			std::thread{ [&]() { timed([this]() { InitializeVoice(); }, times[1]); } },
+			std::thread{ [&]() { timed([this]() { InitializeExpressions(); }, times[2]); } },
+			std::thread{ [&]() { timed([this]() { InitializeFurnitures(); }, times[3]); } }
 		};
 		for (auto& thread : threads) {
 			thread.join();
 		}
 #else
-		InitializeScenes();
-		InitializeVoice();
-		InitializeExpressions();
-		InitializeFurnitures();
+		timed([this]() { InitializeScenes(); }, times[0]);
+		timed([this]() { InitializeVoice(); }, times[1]);
+		timed([this]() { InitializeExpressions(); }, times[2]);
+		timed([this]() { InitializeFurnitures(); }, times[3]);
 #endif
+		initializerTimes = {
+			{ "Scenes", times[0] },
+			{ "Voices", times[1] },
+			{ "Expressions", times[2] },
+			{ "Furnitures", times[3] }
+		};
 
 		const auto tEnd = std::chrono::high_resolution_clock::now();
 		std::chrono::duration<double, std::milli> ms = tEnd - tStart;
 		logger::info("Loaded {} Packages ({} scenes | {} categories)", packages.size(), GetSceneCount(), scenes.size());
+		const auto transforms = Pool<Coordinate, CoordinateHash>::GetSingleton()->GetStatistics();
+		const auto navtexts = Pool<std::string>::GetSingleton()->GetStatistics();
+		logger::info("Deduplicated {} Transforms to {} and {} Navtexts to {}", transforms.requests, transforms.unique, navtexts.requests, navtexts.unique);
 		logger::info("Loaded {} Voices", voices.size());
 		logger::info("Loaded {} VoiceType-Pitches", savedPitches.size());
 		logger::info("Loaded {} Cached Voices", savedVoices.size());
 		logger::info("Loaded {} Expressions", expressions.size());
 		logger::info("Loaded {} Furnitures", furnitures.size());
-		logger::info("Library loaded in {}ms", ms.count());
+		logger::info("Library loaded in {}ms ({} stage loading)", ms.count(), Settings::bLazySceneStages ? "lazy" : "eager");
 	}
 
 	bool Library::FolderExists(const char* path, bool notifyUser) const noexcept
@@ -60,13 +78,15 @@ namespace Registry
 	void Library::InitializeScenes() noexcept
 	{
 		if (!FolderExists(SCENE_PATH, true)) return;
+		std::vector<std::pair<uint64_t, Scene*>> bucketEntries{};	// Collected from every package before building the lookup table
+		std::vector<std::tuple<size_t, uint64_t, PartialEntry>> partialCollected{};	// Open positions, subset hash, entry
 #ifndef SKYRIMVR
 		std::vector<std::thread> threads;
 #endif
 		for (auto& file : fs::recursive_directory_iterator{ SCENE_PATH }) {
 			if (file.path().extension() != ".slr") continue;
 #ifndef SKYRIMVR
-			threads.emplace_back([this, file]() {
+			threads.emplace_back([this, file, &bucketEntries, &partialCollected]() {
 #endif
 				const auto filename = file.path().filename().string();
 				try {
@@ -76,20 +96,42 @@ namespace Registry
 							acc.push_back(pos.data.Split());
 							return std::move(acc);
 						});
+						// Collected per scene and merged under the lock once, abstract positions repeat most keys and subsets
+						std::vector<uint64_t> keys{};
+						std::vector<std::tuple<size_t, ActorFragment::FragmentHash, ActorFragment::FragmentHash>> partials{};
 						Combinatorics::ForEachCombination<ActorFragment>(positionFragments, [&](const std::vector<std::vector<ActorFragment>::const_iterator>& it) {
 							std::vector<ActorFragment> argFragment{};
 							argFragment.reserve(it.size());
 							for (auto&& itF : it) {
 								argFragment.emplace_back(*itF);
 							}
-							const auto key = ActorFragment::MakeFragmentHash(argFragment);
-							const std::unique_lock lock{ _mScenes };
-							auto& vec = scenes[key];
-							if (!std::ranges::contains(vec, scene.get())) {
-								vec.push_back(scene.get());
+							keys.push_back(ActorFragment::MakeFragmentHash(argFragment).to_ullong());
+							// Every proper subset of the composition, keyed by the number of positions it leaves open
+							const auto count = argFragment.size();
+							for (uint32_t mask = 1; mask < (1U << count) - 1; mask++) {
+								std::vector<ActorFragment> subset{}, open{};
+								for (size_t i = 0; i < count; i++) {
+									(mask & (1U << i) ? subset : open).push_back(argFragment[i]);
+								}
+								partials.emplace_back(open.size(), ActorFragment::MakeFragmentHash(subset), ActorFragment::MakeFragmentHash(open));
 							}
 							return Combinatorics::CResult::Next;
 						});
+						std::ranges::sort(keys);
+						keys.erase(std::ranges::unique(keys).begin(), keys.end());
+						std::ranges::sort(partials, {}, [](const auto& a_partial) {
+							const auto& [openCount, subset, open] = a_partial;
+							return std::tuple{ openCount, subset.to_ullong(), open.to_ullong() };
+						});
+						partials.erase(std::ranges::unique(partials).begin(), partials.end());
+
+						const std::unique_lock lock{ _mScenes };
+						for (auto&& key : keys) {
+							bucketEntries.emplace_back(key, scene.get());
+						}
+						for (auto&& [openCount, subset, open] : partials) {
+							partialCollected.emplace_back(openCount, subset.to_ullong(), PartialEntry{ scene.get(), open });
+						}
 						sceneMap[scene->id] = scene.get();
 					}
 					logger::info("InitializeScenes: Finished parsing file {}", filename);
@@ -105,24 +147,53 @@ namespace Registry
 			thread.join();
 #endif
 		}
+		std::unique_lock lock{ _mScenes };
+		scenes.Build(std::move(bucketEntries));
+		partialEntries.clear();
+		partialEntries.reserve(partialCollected.size());
+		for (auto&& [openCount, subset, entry] : partialCollected) {
+			partialEntries.push_back(entry);
+		}
+		std::ranges::sort(partialEntries);
+		partialEntries.erase(std::ranges::unique(partialEntries).begin(), partialEntries.end());
+		partialEntries.shrink_to_fit();
+		// partialEntries is final, the index can point into it
+		std::array<std::vector<std::pair<uint64_t, const PartialEntry*>>, ActorFragment::MAX_ACTOR_COUNT> partialIndex{};
+		for (auto&& [openCount, subset, entry] : partialCollected) {
+			partialIndex[openCount].emplace_back(subset, &*std::ranges::lower_bound(partialEntries, entry));
+		}
+		partialCollected = {};
+		for (size_t i = 0; i < partialIndex.size(); i++) {
+			// Ordinals are assigned in order of first appearance, in entry order the matches of a scene stay adjacent
+			std::ranges::sort(partialIndex[i], {}, [](const auto& a_pair) { return a_pair.second; });
+			partialScenes[i].Build(std::move(partialIndex[i]));
+		}
+		lock.unlock();
 		InitializeSceneSettings();
 	}
 
 	void Library::InitializeSceneSettings() noexcept
 	{
 		if (!FolderExists(SCENE_USER_CONFIG, false)) return;
-		std::unique_lock lock{ _mScenes };
+		// A package may have settings in both formats after switching between them, only the most recent one is read
+		std::map<fs::path, fs::path> files{};
 		for (auto& file : fs::directory_iterator{ SCENE_USER_CONFIG }) {
-			if (const auto ext = file.path().extension(); ext != ".yaml" && ext != ".yml")
+			if (const auto ext = file.path().extension(); ext != ".yaml" && ext != ".yml" && ext != SCENE_USER_BINARY_EXT)
 				continue;
-			const auto filename = file.path().filename().string();
+			auto [it, inserted] = files.try_emplace(file.path().stem(), file.path());
+			if (!inserted && fs::last_write_time(it->second) < file.last_write_time()) {
+				it->second = file.path();
+			}
+		}
+		std::unique_lock lock{ _mScenes };
+		for (auto&& [stem, file] : files) {
+			const auto filename = file.filename().string();
+			const bool isBinary = file.extension() == SCENE_USER_BINARY_EXT;
 			try {
-				const auto root = YAML::LoadFile(file.path().string());
-				for (auto&& [key, scene] : sceneMap) {
-					const auto node = root[scene->id];
-					if (!node.IsDefined())
-						continue;
-					scene->Load(node);
+				if (isBinary) {
+					LoadSceneSettingsBinary(file, !Settings::bBinarySceneSettings);
+				} else {
+					LoadSceneSettingsYaml(file, Settings::bBinarySceneSettings);
 				}
 				logger::info("InitializeScenes: Finished parsing file {}", filename);
 			} catch (const std::exception& e) {
@@ -131,6 +202,51 @@ namespace Registry
 		}
 	}
 
+	void Library::LoadSceneSettingsYaml(const fs::path& a_file, bool a_migrate)
+	{
+		const auto root = YAML::LoadFile(a_file.string());
+		for (auto&& [key, scene] : sceneMap) {
+			const auto node = root[scene->id];
+			if (!node.IsDefined())
+				continue;
+			scene->Load(node);
+			scene->has_edits |= a_migrate;
+		}
+	}
+
+	void Library::LoadSceneSettingsBinary(const fs::path& a_file, bool a_migrate)
+	{
+		std::ifstream stream(a_file, std::ios::binary);
+		stream.exceptions(std::fstream::badbit | std::fstream::failbit | std::fstream::eofbit);
+
+		const auto magic = Binary::ReadId(stream, SCENE_USER_BINARY_MAGIC.size());
+		if (magic != SCENE_USER_BINARY_MAGIC) {
+			throw std::runtime_error("Not a scene settings file");
+		}
+		const auto version = Binary::Read<uint8_t>(stream);
+		if (version > SCENE_USER_BINARY_VERSION) {
+			throw std::runtime_error(std::format("Unsupported version {}", version));
+		}
+		const auto sceneCount = Binary::Read<uint32_t>(stream);
+		for (size_t i = 0; i < sceneCount; i++) {
+			const auto id = Binary::ReadId(stream, Decode::ID_SIZE);
+			const auto size = Binary::Read<uint32_t>(stream);
+			const auto where = sceneMap.find(RE::BSFixedString{ id });
+			if (where == sceneMap.end()) {
+				stream.ignore(size);
+				continue;
+			}
+			auto record = Binary::ReadRecord(stream, size);
+			try {
+				where->second->Load(record);
+			} catch (const std::exception& e) {
+				logger::warn("{}: Skipping malformed settings of scene {}: {}", a_file.filename().string(), id, e.what());
+				continue;
+			}
+			where->second->has_edits |= a_migrate;
+		}
+	}
+
 	void Library::InitializeFurnitures() noexcept
 	{
 		if (!FolderExists(FURNITURE_PATH, false)) return;
@@ -170,6 +286,7 @@ namespace Registry
 			expressions.emplace(name, Expression{ value });
 			logger::info("InitializeExpressions: Added default expression {}", name);
 		}
+		BuildExpressionBuckets();
 	}
 
 	void Library::InitializeExpressionsImpl() noexcept
@@ -223,6 +340,7 @@ namespace Registry
 		InitializeVoicePitches();
 		InitializeVoiceSettings();
 		InitializeVoiceCache();
+		BuildVoiceBuckets();
 	}
 
 	void Library::InitializeVoiceImpl() noexcept
@@ -284,7 +402,10 @@ namespace Registry
 
 	void Library::InitializeVoiceSettings() noexcept
 	{
-		if (!FolderExists(VOICE_SETTING_PATH, false)) return;
+		if (!FolderExists(VOICE_SETTING_PATH, false)) {
+			voiceSettingsDirty = true;
+			return;
+		}
 		try {
 			const auto root = YAML::LoadFile(VOICE_SETTING_PATH);
 			for (auto&& it : root) {
@@ -304,6 +425,13 @@ namespace Registry
 
 	void Library::InitializeVoiceCache() noexcept
 	{
+		if (fs::exists(VOICE_JOURNAL_PATH)) {
+			LoadVoiceJournal();
+			return;
+		}
+		// No journal yet, the first save has to write its header
+		voiceJournalCompact = true;
+		// Legacy cache, migrated into the journal on the next save
 		if (!FolderExists(VOICE_SETTINGS_CACHES_PATH, false)) return;
 		try {
 			const auto root = YAML::LoadFile(VOICE_SETTINGS_CACHES_PATH);
@@ -326,6 +454,44 @@ namespace Registry
 		}
 	}
 
+	void Library::LoadVoiceJournal() noexcept
+	{
+		std::ifstream stream(VOICE_JOURNAL_PATH, std::ios::binary);
+		const auto magic = Binary::ReadId(stream, VOICE_JOURNAL_MAGIC.size());
+		const auto version = Binary::Read<uint8_t>(stream);
+		if (!stream || magic != VOICE_JOURNAL_MAGIC || version > VOICE_JOURNAL_VERSION) {
+			logger::error("InitializeVoice: {} is not a valid voice journal, cached voices will be reset", VOICE_JOURNAL_PATH);
+			voiceJournalCompact = true;
+			return;
+		}
+		while (stream.peek() != std::char_traits<char>::eof()) {
+			const auto op = static_cast<VoiceJournalOp>(Binary::Read<uint8_t>(stream));
+			const auto formStr = Binary::Read<std::string>(stream);
+			const auto voiceStr = op == VoiceJournalOp::Save ? Binary::Read<std::string>(stream) : std::string{};
+			if (!stream) {
+				// A save interrupted while appending, everything before the broken record is intact
+				logger::warn("InitializeVoice: Voice journal ends in an incomplete record after {} records", voiceJournalRecords);
+				voiceJournalCompact = true;
+				break;
+			}
+			voiceJournalRecords++;
+			const auto id = Util::FormFromString(formStr);
+			if (id == 0)
+				continue;
+			if (op == VoiceJournalOp::Clear) {
+				savedVoices.erase(id);
+				continue;
+			}
+			const auto voice = voices.find(RE::BSFixedString{ voiceStr });
+			if (voice == voices.end()) {
+				logger::error("InitializeVoice: Actor {:X} uses unknown Voice {}", id, voiceStr);
+				continue;
+			}
+			savedVoices.insert_or_assign(id, &voice->second);
+		}
+		voiceJournalCompact |= voiceJournalRecords >= std::max(savedVoices.size() * 2, VOICE_JOURNAL_MIN_COMPACT);
+	}
+
 	void Library::Save() const noexcept
 	{
 		SaveScenes();
@@ -337,23 +503,61 @@ namespace Registry
 	void Library::SaveScenes() const noexcept
 	{
 		std::shared_lock lock{ _mScenes };
+		sceneFilesWritten = 0;
+		sceneBytesWritten = 0;
 		std::vector<std::thread> threads{};
 		for (auto&& p : packages) {
+			if (!p->HasEdits())
+				continue;
 			threads.emplace_back([&]() {
-				YAML::Node data{};
-				for (auto&& scene : p->scenes) {
-					auto node = data[scene->id];
-					scene->Save(node);
+				std::string data{};
+				std::string filepath{};
+				if (Settings::bBinarySceneSettings) {
+					std::ostringstream out{};
+					Binary::WriteId(out, SCENE_USER_BINARY_MAGIC, SCENE_USER_BINARY_MAGIC.size());
+					Binary::Write(out, SCENE_USER_BINARY_VERSION);
+					Binary::Write(out, static_cast<uint32_t>(p->scenes.size()));
+					for (auto&& scene : p->scenes) {
+						std::ostringstream record{};
+						scene->Save(record);
+						const auto payload = record.str();
+						Binary::WriteId(out, scene->id, Decode::ID_SIZE);
+						Binary::Write(out, static_cast<uint32_t>(payload.size()));
+						out.write(payload.data(), payload.size());
+					}
+					data = out.str();
+					filepath = std::format("{}\\{}_{}{}", SCENE_USER_CONFIG, p->GetName().data(), p->GetHash(), SCENE_USER_BINARY_EXT);
+				} else {
+					YAML::Node root{};
+					for (auto&& scene : p->scenes) {
+						auto node = root[scene->id];
+						scene->Save(node);
+					}
+					YAML::Emitter out{};
+					out << root;
+					data = out.c_str();
+					filepath = std::format("{}\\{}_{}.yaml", SCENE_USER_CONFIG, p->GetName().data(), p->GetHash());
 				}
-				const auto filepath = std::format("{}\\{}_{}.yaml", SCENE_USER_CONFIG, p->GetName().data(), p->GetHash());
-				std::ofstream fout(filepath);
-				fout << data;
+				std::ofstream fout(filepath, std::ios::binary);
+				fout.write(data.data(), data.size());
+				if (!fout) {
+					logger::error("Failed to write scene settings to {}", filepath);
+					return;
+				}
+				p->ClearEdits();
+				sceneFilesWritten += 1;
+				sceneBytesWritten += data.size();
 			});
 		}
 		for (auto&& thread : threads) {
 			thread.join();
 		}
-		logger::info("Saved scenes");
+		logger::info("Saved scenes ({} files | {} bytes)", sceneFilesWritten.load(), sceneBytesWritten.load());
+	}
+
+	Library::SaveStatistics Library::GetSceneSaveStatistics() const
+	{
+		return { sceneFilesWritten.load(), sceneBytesWritten.load() };
 	}
 
 	void Library::SaveExpressions() const noexcept
@@ -367,38 +571,110 @@ namespace Registry
 
 	void Library::SaveVoices() const noexcept
 	{
-		const auto getSavefile = [](auto path) -> YAML::Node {
+		if (voiceSettingsDirty.exchange(false)) {
+			YAML::Node settings{};
 			try {
-				if (fs::exists(path))
-					return YAML::LoadFile(path);
+				if (fs::exists(VOICE_SETTING_PATH))
+					settings = YAML::LoadFile(VOICE_SETTING_PATH);
 			} catch (const std::exception& e) {
-				logger::error("Error while loading voice settings {}: {}. The file will be re-generated", path, e.what());
+				logger::error("Error while loading voice settings {}: {}. The file will be re-generated", VOICE_SETTING_PATH, e.what());
+			}
+			std::shared_lock lock{ _mVoice };
+			for (auto&& [name, voice] : voices) {
+				auto voiceNode = settings[name.data()];
+				voice.Save(voiceNode);
+			}
+			lock.unlock();
+			std::ofstream fout_settings(VOICE_SETTING_PATH);
+			fout_settings << settings;
+		}
+		SaveVoiceJournal();
+		logger::info("Saved voices");
+	}
+
+	void Library::SaveVoiceJournal() const noexcept
+	{
+		// Held throughout so that concurrent saves append their changes in order
+		std::scoped_lock journalLock{ _mVoiceJournal };
+		// Appending to a missing or empty journal would leave it without a header, rewrite it in full instead
+		std::error_code sizeEc{};
+		const auto journalSize = fs::file_size(VOICE_JOURNAL_PATH, sizeEc);
+		bool compact;
+		std::vector<VoiceJournalEntry> entries{};
+		{
+			std::unique_lock lock{ _mVoice };
+			compact = voiceJournalCompact || sizeEc || journalSize == 0;
+			if (compact) {
+				entries.reserve(savedVoices.size());
+				for (auto&& [id, voice] : savedVoices) {
+					entries.emplace_back(id, voice->GetId());
+				}
+				voiceJournalPending.clear();
+				voiceJournalCompact = false;
+			} else {
+				entries.swap(voiceJournalPending);
 			}
-			return YAML::Node{};
-		};
-		auto settings = getSavefile(VOICE_SETTING_PATH);
-		for (auto&& [name, voice] : voices) {
-			auto voiceNode = settings[name.data()];
-			voice.Save(voiceNode);
 		}
-		std::ofstream fout_settings(VOICE_SETTING_PATH);
-		fout_settings << settings;
+		if (!compact && entries.empty())
+			return;
 
-		auto cache = getSavefile(VOICE_SETTINGS_CACHES_PATH);
-		for (auto&& [id, voice] : savedVoices) {
-			auto form = RE::TESForm::LookupByID<RE::Actor>(id);
+		std::ostringstream out{};
+		if (compact) {
+			Binary::WriteId(out, VOICE_JOURNAL_MAGIC, VOICE_JOURNAL_MAGIC.size());
+			Binary::Write(out, VOICE_JOURNAL_VERSION);
+		}
+		size_t records = 0;
+		for (auto&& [id, voice] : entries) {
+			// Only unique actors keep their FormID across loads
+			const auto form = RE::TESForm::LookupByID<RE::Actor>(id);
 			if (!form)
 				continue;
-			if (auto base = form->GetActorBase()) {
-				if (!base->IsUnique())
-					continue;
+			if (auto base = form->GetActorBase(); base && !base->IsUnique())
+				continue;
+			const auto op = voice.empty() ? VoiceJournalOp::Clear : VoiceJournalOp::Save;
+			Binary::Write(out, static_cast<uint8_t>(op));
+			Binary::Write(out, Util::FormToString(form));
+			if (op == VoiceJournalOp::Save) {
+				Binary::Write(out, std::string_view{ voice.data() });
 			}
-			auto str = Util::FormToString(form);
-			cache[str] = voice->GetId().data();
+			records++;
+		}
+		const auto data = out.str();
+		if (compact) {
+			const auto tmpPath = std::format("{}.tmp", VOICE_JOURNAL_PATH);
+			{
+				std::ofstream fout(tmpPath, std::ios::binary | std::ios::trunc);
+				fout.write(data.data(), data.size());
+				if (!fout) {
+					logger::error("Failed to write voice journal to {}", tmpPath);
+					std::unique_lock lock{ _mVoice };
+					voiceJournalCompact = true;
+					return;
+				}
+			}
+			std::error_code ec{};
+			fs::rename(tmpPath, VOICE_JOURNAL_PATH, ec);
+			if (ec) {
+				logger::error("Failed to replace voice journal {}: {}", VOICE_JOURNAL_PATH, ec.message());
+				std::unique_lock lock{ _mVoice };
+				voiceJournalCompact = true;
+				return;
+			}
+			voiceJournalRecords = records;
+			logger::info("Compacted voice journal to {} records", records);
+		} else {
+			std::ofstream fout(VOICE_JOURNAL_PATH, std::ios::binary | std::ios::app);
+			fout.write(data.data(), data.size());
+			if (!fout) {
+				logger::error("Failed to append to voice journal {}", VOICE_JOURNAL_PATH);
+				std::unique_lock lock{ _mVoice };
+				voiceJournalCompact = true;
+				return;
+			}
+			voiceJournalRecords += records;
+			std::unique_lock lock{ _mVoice };
+			voiceJournalCompact |= voiceJournalRecords >= std::max(savedVoices.size() * 2, VOICE_JOURNAL_MIN_COMPACT);
 		}
-		std::ofstream fout_caches(VOICE_SETTINGS_CACHES_PATH);
-		fout_caches << cache;
-		logger::info("Saved voices");
 	}
 
 }	 // namespace Registry
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+// Native (little-endian, fixed-width) counterpart to Decode, used for files this plugin writes itself
+namespace Binary
+{
+	template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+	void Write(std::ostream& a_stream, T a_value)
+	{
+		a_stream.write(reinterpret_cast<const char*>(&a_value), sizeof(T));
+	}
+
+	template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+	void Read(std::istream& a_stream, T& a_out)
+	{
+		a_stream.read(reinterpret_cast<char*>(&a_out), sizeof(T));
+	}
+
+	// Strings are prefixed with their length as uint16
+	inline void Write(std::ostream& a_stream, std::string_view a_value)
+	{
+		const auto length = static_cast<uint16_t>(std::min<size_t>(a_value.size(), UINT16_MAX));
+		Write(a_stream, length);
+		a_stream.write(a_value.data(), length);
+	}
+
+	inline void Read(std::istream& a_stream, std::string& a_out)
+	{
+		uint16_t length;
+		Read(a_stream, length);
+		a_out.resize(length);
+		a_stream.read(a_out.data(), length);
+	}
+
+	// Fixed size identifiers, as used by scenes and stages, are written without prefix
+	inline void WriteId(std::ostream& a_stream, std::string_view a_id, size_t a_size)
+	{
+		std::string id{ a_id.substr(0, a_size) };
+		id.resize(a_size, '\0');
+		a_stream.write(id.data(), a_size);
+	}
+
+	inline std::string ReadId(std::istream& a_stream, size_t a_size)
+	{
+		std::string ret(a_size, '\0');
+		a_stream.read(ret.data(), a_size);
+		return ret;
+	}
+
+	/// @brief Read a record of exactly a_size bytes into its own stream, so that a malformed record cannot misalign the ones after it
+	/// @throws std::runtime_error if fewer than a_size bytes remain. Reads past the end of the returned stream throw std::ios_base::failure
+	inline std::istringstream ReadRecord(std::istream& a_stream, size_t a_size)
+	{
+		std::string payload(a_size, '\0');
+		a_stream.read(payload.data(), a_size);
+		if (static_cast<size_t>(a_stream.gcount()) != a_size) {
+			throw std::runtime_error(std::format("Truncated record; expected {} bytes but got {}", a_size, a_stream.gcount()));
+		}
+		std::istringstream ret{ std::move(payload) };
+		ret.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
+		return ret;
+	}
+
+	template <typename T>
+	T Read(std::istream& a_stream)
+	{
+		T ret;
+		Read(a_stream, ret);
+		return ret;
+	}
+
+}	 // namespace Binary
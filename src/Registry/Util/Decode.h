@@ -1,6 +1,9 @@
 #pragma once
 
+#include <bit>
+#include <cstring>
 #include <fstream>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -10,43 +13,161 @@ namespace Decode
 	static inline constexpr size_t HASH_SIZE = 4;
 	static inline constexpr size_t ID_SIZE = 8;
 
+	enum class Format
+	{
+		Legacy,	 // Version 1-4: big-endian integers, floats stored as int32 / 1000
+		Native,	 // Version 5+: little-endian integers, IEEE-754 floats
+	};
+
+	_NODISCARD constexpr Format GetFormat(uint8_t a_version) { return a_version >= 5 ? Format::Native : Format::Legacy; }
+
+	/// @brief Forward-only, bounds checked view into a fully buffered .slr file
+	class Cursor
+	{
+	public:
+		/// @param a_base Offset of a_data in the file it was read from, used for reporting
+		Cursor(std::span<const char> a_data, Format a_format = Format::Legacy, size_t a_base = 0) :
+			_data(a_data), _format(a_format), _base(a_base) {}
+		~Cursor() = default;
+
+		_NODISCARD Format GetFormat() const { return _format; }
+		void SetFormat(Format a_format) { _format = a_format; }
+		/// @brief Offset of the cursor in the file
+		_NODISCARD size_t GetOffset() const { return _base + _offset; }
+		_NODISCARD size_t GetRemaining() const { return _data.size() - _offset; }
+
+		/// @brief Advance the cursor by a_size bytes and return a view on the skipped bytes
+		/// @throws std::runtime_error if fewer than a_size bytes remain, naming the field and offset being read
+		std::span<const char> Take(size_t a_size, std::string_view a_field)
+		{
+			if (a_size > GetRemaining()) {
+				const auto err = std::format("Unexpected end of data reading '{}' at offset {}; need {} bytes but only {} remain", a_field, GetOffset(), a_size, GetRemaining());
+				throw std::runtime_error(err.c_str());
+			}
+			const auto ret = _data.subspan(_offset, a_size);
+			_offset += a_size;
+			return ret;
+		}
+
+	private:
+		std::span<const char> _data;
+		Format _format;
+		size_t _base;
+		size_t _offset{ 0 };
+	};
+
+	/// @brief Read the entire file into memory in a single call
+	inline std::vector<char> LoadFile(const fs::path& a_file)
+	{
+		std::ifstream stream(a_file, std::ios::binary);
+		if (!stream) {
+			const auto err = std::format("Unable to open file {}", a_file.string());
+			throw std::runtime_error(err.c_str());
+		}
+		std::vector<char> buffer(fs::file_size(a_file));
+		stream.read(buffer.data(), buffer.size());
+		if (static_cast<size_t>(stream.gcount()) != buffer.size()) {
+			const auto err = std::format("Unable to read file {}; expected {} bytes but got {}", a_file.string(), buffer.size(), stream.gcount());
+			throw std::runtime_error(err.c_str());
+		}
+		return buffer;
+	}
+
+	/// @brief Read a_size bytes starting at a_offset
+	inline std::vector<char> LoadFile(const fs::path& a_file, size_t a_offset, size_t a_size)
+	{
+		std::ifstream stream(a_file, std::ios::binary);
+		if (!stream) {
+			const auto err = std::format("Unable to open file {}", a_file.string());
+			throw std::runtime_error(err.c_str());
+		}
+		std::vector<char> buffer(a_size);
+		stream.seekg(a_offset);
+		stream.read(buffer.data(), buffer.size());
+		if (static_cast<size_t>(stream.gcount()) != buffer.size()) {
+			const auto err = std::format("Unable to read file {}; expected {} bytes at offset {} but got {}", a_file.string(), buffer.size(), a_offset, stream.gcount());
+			throw std::runtime_error(err.c_str());
+		}
+		return buffer;
+	}
+
 	template <typename I, std::enable_if_t<std::is_integral<I>::value, bool> = true>
-	void Read(std::ifstream& a_stream, I& a_out)
+	void Read(Cursor& a_cursor, I& a_out, std::string_view a_field)
 	{
-		constexpr size_t n = sizeof(I);
-		uint8_t buffer[n];
-		a_stream.read(reinterpret_cast<char*>(buffer), n);
-		a_out = 0;
-		for (int32_t i = 0; i < n; i++) {
-			a_out = (a_out << 8) | buffer[i];
+		const auto bytes = a_cursor.Take(sizeof(I), a_field);
+		std::memcpy(&a_out, bytes.data(), sizeof(I));
+		if constexpr (sizeof(I) > 1) {
+			const auto fileEndian = a_cursor.GetFormat() == Format::Native ? std::endian::little : std::endian::big;
+			if (fileEndian != std::endian::native) {
+				a_out = std::byteswap(a_out);
+			}
 		}
 	}
 
 	template <typename F, std::enable_if_t<std::is_floating_point<F>::value, bool> = true>
-	void Read(std::ifstream& a_stream, F& a_out)
+	void Read(Cursor& a_cursor, F& a_out, std::string_view a_field)
 	{
+		if (a_cursor.GetFormat() == Format::Native) {
+			static_assert(std::endian::native == std::endian::little);
+			float tmp;
+			const auto bytes = a_cursor.Take(sizeof(tmp), a_field);
+			std::memcpy(&tmp, bytes.data(), sizeof(tmp));
+			a_out = tmp;
+			return;
+		}
 		int32_t tmp;
-		Read(a_stream, tmp);
+		Read(a_cursor, tmp, a_field);
 		a_out = static_cast<float>(tmp) / 1000.0f;
 	}
 
 	template <typename S, std::enable_if_t<std::is_same_v<S, std::string> || std::is_same_v<S, RE::BSFixedString>, bool> = true>
-	void Read(std::ifstream& a_stream, S& a_out)
+	void Read(Cursor& a_cursor, S& a_out, std::string_view a_field)
 	{
 		uint64_t u64;
-		Read(a_stream, u64);
-		std::vector<char> buffer;
-		buffer.resize(u64);
-		a_stream.read(buffer.data(), u64);
-		a_out = std::string{ buffer.begin(), buffer.end() };
+		Read(a_cursor, u64, a_field);
+		const auto bytes = a_cursor.Take(u64, a_field);
+		a_out = std::string_view{ bytes.data(), bytes.size() };
 	}
 
 	template <typename T>
-	T Read(std::ifstream& a_stream)
+	T Read(Cursor& a_cursor, std::string_view a_field)
 	{
 		T ret;
-		Read(a_stream, ret);
+		Read(a_cursor, ret, a_field);
 		return ret;
 	}
 
+	/// @brief Read an element count, rejecting counts the remaining data cannot possibly hold before anything is sized by it
+	/// @param a_minSize Smallest encoded size of a single element
+	inline uint64_t ReadCount(Cursor& a_cursor, size_t a_minSize, std::string_view a_field)
+	{
+		const auto count = Read<uint64_t>(a_cursor, a_field);
+		if (count > a_cursor.GetRemaining() / std::max<size_t>(a_minSize, 1)) {
+			const auto err = std::format("Invalid count {} reading '{}' at offset {}; only {} bytes remain", count, a_field, a_cursor.GetOffset(), a_cursor.GetRemaining());
+			throw std::runtime_error(err.c_str());
+		}
+		return count;
+	}
+
+	/// @brief Advance past a length prefixed string without decoding it
+	inline void SkipString(Cursor& a_cursor, std::string_view a_field)
+	{
+		const auto length = Read<uint64_t>(a_cursor, a_field);
+		a_cursor.Take(length, a_field);
+	}
+
+	/// @brief Read a fixed size identifier, such as a package hash or scene/stage id
+	inline std::string ReadId(Cursor& a_cursor, size_t a_size, std::string_view a_field)
+	{
+		const auto bytes = a_cursor.Take(a_size, a_field);
+		return std::string{ bytes.data(), bytes.size() };
+	}
+
+	/// @brief Copy a_size bytes as they are stored in the file, without any conversion
+	inline void ReadRaw(Cursor& a_cursor, void* a_out, size_t a_size, std::string_view a_field)
+	{
+		const auto bytes = a_cursor.Take(a_size, a_field);
+		std::memcpy(a_out, bytes.data(), a_size);
+	}
+
 }	 // namespace Decode
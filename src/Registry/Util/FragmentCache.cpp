@@ -0,0 +1,87 @@
+#include "FragmentCache.h"
+
+#include "Registry/Define/ActorProfile.h"
+
+namespace Registry
+{
+	ActorFragment FragmentCache::GetFragment(RE::Actor* a_actor)
+	{
+		assert(a_actor);
+		const auto id = a_actor->GetFormID();
+		const auto race = a_actor->GetRace();
+		const auto root = a_actor->Get3D();
+		const auto referenceScale = a_actor->GetScale();
+		const auto factions = ActorProfile::GetFactionFingerprint(a_actor);
+		{
+			std::shared_lock lock{ _m };
+			const auto where = _entries.find(id);
+			if (where != _entries.end()) {
+				const auto& entry = where->second;
+				if (entry.race == race && entry.root == root && entry.referenceScale == referenceScale && entry.factions == factions) {
+					_hits++;
+					return entry.fragment;
+				}
+			}
+		}
+		_misses++;
+		const ActorProfile profile{ a_actor };
+		const auto fragment = ActorFragment::MakeStaticFragment(a_actor, profile);
+		std::unique_lock lock{ _m };
+		_entries.insert_or_assign(id, Entry{ fragment, race, root, referenceScale, profile.fingerprint });
+		return fragment;
+	}
+
+	void FragmentCache::Invalidate(RE::FormID a_id)
+	{
+		std::unique_lock lock{ _m };
+		_entries.erase(a_id);
+	}
+
+	void FragmentCache::Clear()
+	{
+		std::unique_lock lock{ _m };
+		_entries.clear();
+	}
+
+	FragmentCache::Statistics FragmentCache::GetStatistics() const
+	{
+		std::shared_lock lock{ _m };
+		return { _hits.load(), _misses.load(), _entries.size() };
+	}
+
+	FragmentCache::EventResult FragmentCache::ProcessEvent(const RE::TESSwitchRaceCompleteEvent* a_event, RE::BSTEventSource<RE::TESSwitchRaceCompleteEvent>*)
+	{
+		if (!a_event || !a_event->subject)
+			return EventResult::kContinue;
+
+		Invalidate(a_event->subject->formID);
+		return EventResult::kContinue;
+	}
+
+	FragmentCache::EventResult FragmentCache::ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*)
+	{
+		if (!a_event)
+			return EventResult::kContinue;
+
+		Invalidate(a_event->formID);
+		return EventResult::kContinue;
+	}
+
+	FragmentCache::EventResult FragmentCache::ProcessEvent(const RE::TESResetEvent* a_event, RE::BSTEventSource<RE::TESResetEvent>*)
+	{
+		if (!a_event || !a_event->object)
+			return EventResult::kContinue;
+
+		Invalidate(a_event->object->formID);
+		return EventResult::kContinue;
+	}
+
+	void FragmentCache::Register()
+	{
+		const auto script = RE::ScriptEventSourceHolder::GetSingleton();
+		script->AddEventSink<RE::TESSwitchRaceCompleteEvent>(this);
+		script->AddEventSink<RE::TESObjectLoadedEvent>(this);
+		script->AddEventSink<RE::TESResetEvent>(this);
+	}
+
+}	 // namespace Registry
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <shared_mutex>
+
+#include "Registry/Define/Fragment.h"
+
+namespace Registry
+{
+	/// @brief Per actor cache of the parts of an ActorFragment that rarely change (sex, race, vampirism and scale)
+	/// Submissive and unconscious state are cheap to query and evaluated by the ActorFragment constructor on every call
+	/// Faction changes (gender override, SOS) have no event, entries remember the faction fingerprint they were built from instead
+	class FragmentCache :
+		public Singleton<FragmentCache>,
+		public RE::BSTEventSink<RE::TESSwitchRaceCompleteEvent>,
+		public RE::BSTEventSink<RE::TESObjectLoadedEvent>,
+		public RE::BSTEventSink<RE::TESResetEvent>
+	{
+		using EventResult = RE::BSEventNotifyControl;
+
+		struct Entry
+		{
+			ActorFragment fragment;
+			// Cheap to compare state, an entry is rebuilt if any of these differ from the actor
+			const RE::TESRace* race;
+			const RE::NiAVObject* root;
+			float referenceScale;
+			uint64_t factions;	// ActorProfile::fingerprint
+		};
+
+	public:
+		struct Statistics
+		{
+			size_t hits{ 0 };
+			size_t misses{ 0 };
+			size_t entries{ 0 };
+		};
+
+	public:
+		/// @brief Get the static part of the fragment for this actor, building it if missing or outdated
+		/// @throws std::runtime_error if the actor has no valid sex or race, see ActorFragment::MakeStaticFragment
+		_NODISCARD ActorFragment GetFragment(RE::Actor* a_actor);
+		void Invalidate(RE::FormID a_id);
+		void Clear();
+		_NODISCARD Statistics GetStatistics() const;
+
+		EventResult ProcessEvent(const RE::TESSwitchRaceCompleteEvent* a_event, RE::BSTEventSource<RE::TESSwitchRaceCompleteEvent>*) override;
+		EventResult ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override;
+		EventResult ProcessEvent(const RE::TESResetEvent* a_event, RE::BSTEventSource<RE::TESResetEvent>*) override;
+
+		void Register();
+
+	private:
+		mutable std::shared_mutex _m{};
+		std::unordered_map<RE::FormID, Entry> _entries{};
+		std::atomic<size_t> _hits{ 0 };
+		std::atomic<size_t> _misses{ 0 };
+	};
+
+}	 // namespace Registry
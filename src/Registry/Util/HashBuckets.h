@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Registry
+{
+	/// @brief Immutable multimap from 64-bit keys to elements, stored as a flat open-addressing table
+	/// Every element is assigned an ordinal, each key maps to a contiguous span of ordinals in a single shared array
+	/// @note Key 0 is reserved to mark empty slots
+	template <class T>
+	class HashBuckets
+	{
+		static constexpr uint64_t EMPTY = 0;
+		static constexpr size_t MIN_CAPACITY = 16;
+
+		struct Slot
+		{
+			uint64_t key{ EMPTY };
+			uint32_t begin{ 0 };
+			uint32_t count{ 0 };
+		};
+
+	public:
+		HashBuckets() = default;
+		~HashBuckets() = default;
+
+		/// @brief Replace the contents of the table, duplicate (key, element) pairs are merged
+		void Build(std::vector<std::pair<uint64_t, T*>> a_entries)
+		{
+			_elements.clear();
+			_ordinals.clear();
+			std::unordered_map<T*, uint32_t> ordinalMap{};
+			std::vector<std::pair<uint64_t, uint32_t>> entries{};
+			entries.reserve(a_entries.size());
+			for (auto&& [key, element] : a_entries) {
+				assert(key != EMPTY);
+				const auto [where, inserted] = ordinalMap.try_emplace(element, static_cast<uint32_t>(_elements.size()));
+				if (inserted) {
+					_elements.push_back(element);
+				}
+				entries.emplace_back(key, where->second);
+			}
+			std::ranges::sort(entries);
+			const auto [first, last] = std::ranges::unique(entries);
+			entries.erase(first, last);
+
+			_size = 0;
+			for (size_t i = 0; i < entries.size(); i++) {
+				_size += i == 0 || entries[i].first != entries[i - 1].first;
+			}
+			_slots.assign(std::max(MIN_CAPACITY, std::bit_ceil(_size * 2)), Slot{});
+			_ordinals.reserve(entries.size());
+			for (size_t i = 0; i < entries.size();) {
+				const auto key = entries[i].first;
+				auto& slot = _slots[FindSlot(key)];
+				slot.key = key;
+				slot.begin = static_cast<uint32_t>(_ordinals.size());
+				for (; i < entries.size() && entries[i].first == key; i++) {
+					_ordinals.push_back(entries[i].second);
+				}
+				slot.count = static_cast<uint32_t>(_ordinals.size() - slot.begin);
+			}
+		}
+
+		/// @brief Ordinals of all elements stored under a_key, empty if the key is not in the table
+		_NODISCARD std::span<const uint32_t> GetOrdinals(uint64_t a_key) const
+		{
+			if (_slots.empty() || a_key == EMPTY)
+				return {};
+			const auto& slot = _slots[FindSlot(a_key)];
+			if (slot.key != a_key)
+				return {};
+			return std::span{ _ordinals }.subspan(slot.begin, slot.count);
+		}
+
+		/// @brief All elements stored under a_key
+		_NODISCARD auto Find(uint64_t a_key) const
+		{
+			return GetOrdinals(a_key) | std::views::transform([this](uint32_t a_ordinal) { return _elements[a_ordinal]; });
+		}
+
+		_NODISCARD T* GetElement(uint32_t a_ordinal) const { return _elements[a_ordinal]; }
+		_NODISCARD bool Contains(uint64_t a_key) const { return !GetOrdinals(a_key).empty(); }
+
+		/// @brief Visit every key with the ordinals stored under it, in no particular order
+		template <class F>
+		void ForEachBucket(F&& a_visitor) const
+		{
+			for (auto&& slot : _slots) {
+				if (slot.key != EMPTY) {
+					a_visitor(slot.key, std::span{ _ordinals }.subspan(slot.begin, slot.count));
+				}
+			}
+		}
+
+		/// @brief Number of distinct keys
+		_NODISCARD size_t size() const { return _size; }
+		_NODISCARD size_t capacity() const { return _slots.size(); }
+		_NODISCARD size_t GetMemoryUsage() const
+		{
+			return _slots.capacity() * sizeof(Slot) + _ordinals.capacity() * sizeof(uint32_t) + _elements.capacity() * sizeof(T*);
+		}
+
+	private:
+		// Finalizer of splitmix64, fragment hashes differ mostly in their high bits
+		_NODISCARD static constexpr uint64_t Mix(uint64_t a_key)
+		{
+			a_key ^= a_key >> 30;
+			a_key *= 0xBF58476D1CE4E5B9ULL;
+			a_key ^= a_key >> 27;
+			a_key *= 0x94D049BB133111EBULL;
+			return a_key ^ (a_key >> 31);
+		}
+
+		/// @brief Index of the slot holding a_key, or of the empty slot where it would be inserted
+		_NODISCARD size_t FindSlot(uint64_t a_key) const
+		{
+			const auto mask = _slots.size() - 1;
+			auto i = static_cast<size_t>(Mix(a_key)) & mask;
+			while (_slots[i].key != EMPTY && _slots[i].key != a_key) {
+				i = (i + 1) & mask;
+			}
+			return i;
+		}
+
+	private:
+		std::vector<Slot> _slots{};
+		std::vector<uint32_t> _ordinals{};
+		std::vector<T*> _elements{};
+		size_t _size{ 0 };
+	};
+
+}	 // namespace Registry
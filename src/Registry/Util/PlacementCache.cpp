@@ -0,0 +1,140 @@
+#include "PlacementCache.h"
+
+namespace Registry
+{
+	size_t PlacementCache::KeyHash::operator()(const Key& a_key) const
+	{
+		size_t seed = std::hash<RE::FormID>{}(a_key.reference);
+		for (auto&& value : { std::hash<const void*>{}(a_key.details), std::hash<uint32_t>{}(a_key.filter) }) {
+			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+		return seed;
+	}
+
+	std::optional<std::vector<FurnitureOffset>> PlacementCache::Find(const FurnitureDetails* a_details, const RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter)
+	{
+		assert(a_details && a_ref);
+		const Key key{ a_ref->GetFormID(), a_details, a_filter.underlying() };
+		std::scoped_lock lock{ _m };
+		const auto where = _lookup.find(key);
+		if (where == _lookup.end())
+			return std::nullopt;
+		const auto& entry = *where->second;
+		if (entry.location != a_ref->data.location || entry.angle != a_ref->data.angle || entry.root != a_ref->Get3D() || Clock::now() - entry.stored > ENTRY_LIFETIME) {
+			_recent.erase(where->second);
+			_lookup.erase(where);
+			return std::nullopt;
+		}
+		_recent.splice(_recent.begin(), _recent, where->second);
+		return entry.offsets;
+	}
+
+	void PlacementCache::Insert(const FurnitureDetails* a_details, const RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter, std::vector<FurnitureOffset> a_offsets)
+	{
+		assert(a_details && a_ref);
+		const Key key{ a_ref->GetFormID(), a_details, a_filter.underlying() };
+		Entry entry{ key, std::move(a_offsets), a_ref->data.location, a_ref->data.angle, a_ref->Get3D(), Clock::now() };
+		std::scoped_lock lock{ _m };
+		if (const auto where = _lookup.find(key); where != _lookup.end()) {
+			*where->second = std::move(entry);
+			_recent.splice(_recent.begin(), _recent, where->second);
+			return;
+		}
+		_recent.push_front(std::move(entry));
+		_lookup.emplace(key, _recent.begin());
+		if (_recent.size() > CACHE_SIZE) {
+			_lookup.erase(_recent.back().key);
+			_recent.pop_back();
+		}
+	}
+
+	void PlacementCache::Invalidate(RE::FormID a_id)
+	{
+		std::scoped_lock lock{ _m };
+		for (auto it = _recent.begin(); it != _recent.end();) {
+			if (it->key.reference == a_id) {
+				_lookup.erase(it->key);
+				it = _recent.erase(it);
+			} else {
+				it++;
+			}
+		}
+	}
+
+	void PlacementCache::InvalidateNearby(const RE::TESObjectREFR* a_ref)
+	{
+		const auto base = a_ref->GetBaseObject();
+		if (!base)
+			return;
+		switch (base->GetFormType()) {
+		case RE::FormType::Static:
+		case RE::FormType::MovableStatic:
+		case RE::FormType::Furniture:
+		case RE::FormType::Door:
+			break;
+		default:
+			return;
+		}
+		const auto location = a_ref->GetPosition();
+		std::scoped_lock lock{ _m };
+		if (_recent.empty())
+			return;
+		for (auto it = _recent.begin(); it != _recent.end();) {
+			if (it->location.GetDistance(location) <= NEARBY_RADIUS) {
+				_lookup.erase(it->key);
+				it = _recent.erase(it);
+			} else {
+				it++;
+			}
+		}
+	}
+
+	void PlacementCache::Clear()
+	{
+		std::scoped_lock lock{ _m };
+		_lookup.clear();
+		_recent.clear();
+	}
+
+	PlacementCache::EventResult PlacementCache::ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*)
+	{
+		if (!a_event || !a_event->reference)
+			return EventResult::kContinue;
+
+		if (!a_event->attached) {
+			Invalidate(a_event->reference->GetFormID());
+		}
+		InvalidateNearby(a_event->reference.get());
+		return EventResult::kContinue;
+	}
+
+	PlacementCache::EventResult PlacementCache::ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*)
+	{
+		if (!a_event)
+			return EventResult::kContinue;
+
+		Invalidate(a_event->formID);
+		if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(a_event->formID)) {
+			InvalidateNearby(ref);
+		}
+		return EventResult::kContinue;
+	}
+
+	PlacementCache::EventResult PlacementCache::ProcessEvent(const RE::TESOpenCloseEvent* a_event, RE::BSTEventSource<RE::TESOpenCloseEvent>*)
+	{
+		if (!a_event || !a_event->ref)
+			return EventResult::kContinue;
+
+		InvalidateNearby(a_event->ref.get());
+		return EventResult::kContinue;
+	}
+
+	void PlacementCache::Register()
+	{
+		const auto script = RE::ScriptEventSourceHolder::GetSingleton();
+		script->AddEventSink<RE::TESCellAttachDetachEvent>(this);
+		script->AddEventSink<RE::TESObjectLoadedEvent>(this);
+		script->AddEventSink<RE::TESOpenCloseEvent>(this);
+	}
+
+}	 // namespace Registry
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <list>
+
+#include "Registry/Define/Furniture.h"
+
+namespace Registry
+{
+	/// @brief Bounded LRU cache of the offsets FurnitureDetails::GetCoordinatesInBound found unobstructed on a reference
+	/// The raycast sweep behind each result is costly and the same furniture is evaluated repeatedly, an entry is reused
+	/// for as long as the reference keeps its position, rotation and 3D and no obstruction near it was loaded, moved or opened.
+	/// Physics driven clutter sends no event when it moves, entries expire after a while so that it is eventually picked up
+	class PlacementCache :
+		public Singleton<PlacementCache>,
+		public RE::BSTEventSink<RE::TESCellAttachDetachEvent>,
+		public RE::BSTEventSink<RE::TESObjectLoadedEvent>,
+		public RE::BSTEventSink<RE::TESOpenCloseEvent>
+	{
+		using EventResult = RE::BSEventNotifyControl;
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr size_t CACHE_SIZE = 64;
+		static constexpr auto ENTRY_LIFETIME = std::chrono::minutes(30);	// Long enough to span repeated scenes at the same bed or bench
+		static constexpr float NEARBY_RADIUS = 512.0f;	// Changes to obstructions within this distance of a cached reference discard its entry
+
+		struct Key
+		{
+			RE::FormID reference;
+			const FurnitureDetails* details;
+			std::underlying_type_t<FurnitureType::Value> filter;
+
+			bool operator==(const Key&) const = default;
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& a_key) const;
+		};
+
+		struct Entry
+		{
+			Key key;
+			std::vector<FurnitureOffset> offsets;
+			// Cheap to compare state, an entry is discarded if any of these differ from the reference
+			RE::NiPoint3 location;
+			RE::NiPoint3 angle;
+			const RE::NiAVObject* root;
+			Clock::time_point stored;
+		};
+
+	public:
+		/// @brief Get the cached offsets for this reference, if its placement did not change since they were stored
+		_NODISCARD std::optional<std::vector<FurnitureOffset>> Find(const FurnitureDetails* a_details, const RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter);
+		void Insert(const FurnitureDetails* a_details, const RE::TESObjectREFR* a_ref, REX::EnumSet<FurnitureType::Value> a_filter, std::vector<FurnitureOffset> a_offsets);
+		void Invalidate(RE::FormID a_id);
+		/// @brief Discard every entry whose reference is within NEARBY_RADIUS of a_ref, if a_ref can obstruct a placement
+		void InvalidateNearby(const RE::TESObjectREFR* a_ref);
+		void Clear();
+
+		EventResult ProcessEvent(const RE::TESCellAttachDetachEvent* a_event, RE::BSTEventSource<RE::TESCellAttachDetachEvent>*) override;
+		EventResult ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) override;
+		EventResult ProcessEvent(const RE::TESOpenCloseEvent* a_event, RE::BSTEventSource<RE::TESOpenCloseEvent>*) override;
+
+		void Register();
+
+	private:
+		std::mutex _m{};
+		std::list<Entry> _recent{};	 // Most recently used first
+		std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _lookup{};
+	};
+
+}	 // namespace Registry
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_set>
+
+namespace Registry
+{
+	/// @brief Interning pool for immutable values shared across all loaded packages
+	/// Returned pointers are stable and live as long as the plugin
+	template <class T, class Hash = std::hash<T>>
+	class Pool : public Singleton<Pool<T, Hash>>
+	{
+	public:
+		struct Statistics
+		{
+			size_t requests{ 0 };
+			size_t unique{ 0 };
+		};
+
+	public:
+		_NODISCARD const T* Intern(const T& a_value)
+		{
+			std::scoped_lock lock{ _m };
+			_requests++;
+			return &*_values.insert(a_value).first;
+		}
+
+		_NODISCARD Statistics GetStatistics() const
+		{
+			std::scoped_lock lock{ _m };
+			return { _requests, _values.size() };
+		}
+
+	private:
+		mutable std::mutex _m{};
+		std::unordered_set<T, Hash> _values{};
+		size_t _requests{ 0 };
+	};
+
+}	 // namespace Registry
@@ -1,33 +1,25 @@
 #include "Scale.h"
 
+#include "Registry/Util/FragmentCache.h"
+
 namespace Registry
 {
 	float Scale::GetScale(RE::TESObjectREFR* a_reference)
 	{
-		assert(a_reference);
-		const auto node = a_reference->GetNodeByName(basenode);
-    const auto baseScale = a_reference->GetScale();
-		const auto nodeScale = node ? node->local.scale : 1.0f;
-		const auto retVal = baseScale * nodeScale;
-		logger::info("GetScale: {:X} -> Base = {}, Skeleton = {} => {}", a_reference->GetFormID(), baseScale, nodeScale, retVal);
-		return retVal;
+		return ReadScale(a_reference);
 	}
 
-	void Scale::SetScale(RE::Actor* a_actor, float a_absolutescale)
+	float Scale::ReadScale(RE::TESObjectREFR* a_reference) const
 	{
-		SetScale(a_actor, { a_actor }, a_absolutescale);
+		assert(a_reference);
+		const auto node = a_reference->GetNodeByName(basenode);
+		const auto baseScale = a_reference->GetScale();
+		const auto nodeScale = node ? node->local.scale : 1.0f;
+		return baseScale * nodeScale;
 	}
 
-	void Scale::SetScale(RE::Actor* a_actor, RaceKey a_racekey, float a_absolutescale)
+	float Scale::GetRaceScale(RaceKey a_racekey, float a_absolutescale)
 	{
-		assert(a_actor && a_absolutescale > 0.0f);
-		if (Settings::bDisableScale) {
-			return;
-		} else if (!transformInterface) {
-			logger::error("Missing interface, scaling disabled");
-			Settings::bDisableScale = true;
-			return;
-		}
 		switch (a_racekey) {
 		case RaceKey::AshHopper:
 			// a_absolutescale *= 0.5f;
@@ -66,43 +58,119 @@ namespace Registry
 			// a_absolutescale *= 1.0f;
 			break;
 		}
-		float basescale = GetScale(a_actor);
-		if (std::abs(basescale - a_absolutescale) < 0.03) {
-			logger::info("Attempted Node Transform to Actor = {:X}, Scale = {} -> {}", a_actor->GetFormID(), basescale, a_absolutescale);
-			return;
+		return a_absolutescale;
+	}
+
+	bool Scale::IsEnabled()
+	{
+		if (Settings::bDisableScale) {
+			return false;
+		} else if (!transformInterface) {
+			logger::error("Missing interface, scaling disabled");
+			Settings::bDisableScale = true;
+			return false;
 		}
+		return true;
+	}
+
+	bool Scale::WriteScale(RE::Actor* a_actor, float a_absolutescale)
+	{
+		const auto current = ReadScale(a_actor);
+		if (std::abs(current - a_absolutescale) < SCALE_TOLERANCE) {
+			return false;
+		}
+		const auto detect = Settings::bScaleChangeDetection;
 
 		const auto base = a_actor->GetActorBase();
 		const auto female = base ? base->GetSex() == RE::SEXES::kFemale : false;
-		transformInterface->AddNodeTransformScaleMode(a_actor, false, female, basenode, namekey, ScaleModes::Multiplicative);
-		if (transformInterface->RemoveNodeTransformScale(a_actor, false, female, basenode, namekey)) {
-			transformInterface->UpdateNodeTransforms(a_actor, false, female, basenode);
-			basescale = GetScale(a_actor);
+		float basescale = current;
+		const auto where = _applied.find(a_actor->GetFormID());
+		if (detect && where != _applied.end() && std::abs(current - where->second.base * where->second.factor) < SCALE_TOLERANCE) {
+			// Our transform is still the only change to the skeleton, overwrite it without resetting first
+			basescale = where->second.base;
+		} else if (detect && !transformInterface->HasNodeTransformScale(a_actor, false, female, basenode, namekey)) {
+			// Nothing of ours on the skeleton, the current scale already is the base
+			transformInterface->AddNodeTransformScaleMode(a_actor, false, female, basenode, namekey, ScaleModes::Multiplicative);
+		} else {
+			transformInterface->AddNodeTransformScaleMode(a_actor, false, female, basenode, namekey, ScaleModes::Multiplicative);
+			if (transformInterface->RemoveNodeTransformScale(a_actor, false, female, basenode, namekey)) {
+				transformInterface->UpdateNodeTransforms(a_actor, false, female, basenode);
+				basescale = ReadScale(a_actor);
+			}
 		}
 		// base * x = absolute <=> x = absolute / base
 		float x = a_absolutescale / basescale;
 
 		logger::info("Applying Node Transform to Actor = {:X}, Scale = {} -> {}, x = {}", a_actor->GetFormID(), basescale, a_absolutescale, x);
 		transformInterface->AddNodeTransformScale(a_actor, false, female, basenode, namekey, x);
+		_applied.insert_or_assign(a_actor->GetFormID(), Applied{ basescale, x });
+		return true;
+	}
+
+	void Scale::UpdateScale(RE::Actor* a_actor)
+	{
+		const auto base = a_actor->GetActorBase();
+		const auto female = base ? base->GetSex() == RE::SEXES::kFemale : false;
 		transformInterface->UpdateNodeTransforms(a_actor, false, female, basenode);
 	}
 
+	void Scale::SetScale(RE::Actor* a_actor, float a_absolutescale)
+	{
+		SetScale(a_actor, { a_actor }, a_absolutescale);
+	}
+
+	void Scale::SetScale(RE::Actor* a_actor, RaceKey a_racekey, float a_absolutescale)
+	{
+		const Request request{ a_actor, a_racekey, a_absolutescale };
+		SetScale(std::span{ &request, 1 });
+	}
+
+	void Scale::SetScale(std::span<const Request> a_requests)
+	{
+		if (!IsEnabled()) {
+			return;
+		}
+		std::vector<RE::Actor*> changed{};
+		changed.reserve(a_requests.size());
+		{
+			std::scoped_lock lock{ _m };
+			for (auto&& [actor, racekey, scale] : a_requests) {
+				assert(actor && scale > 0.0f);
+				if (WriteScale(actor, GetRaceScale(racekey, scale))) {
+					changed.push_back(actor);
+				}
+			}
+			for (auto&& actor : changed) {
+				UpdateScale(actor);
+			}
+		}
+		const auto cache = FragmentCache::GetSingleton();
+		for (auto&& actor : changed) {
+			cache->Invalidate(actor->GetFormID());
+		}
+	}
+
+	void Scale::Clear()
+	{
+		std::scoped_lock lock{ _m };
+		_applied.clear();
+	}
+
 	void Scale::RemoveScale(RE::Actor* a_actor)
   {
 		assert(a_actor);
-		if (Settings::bDisableScale) {
-			return;
-		} else if (!transformInterface) {
-			logger::error("Missing interface, scaling disabled");
-			Settings::bDisableScale = true;
+		if (!IsEnabled()) {
 			return;
 		}
 
 		const auto base = a_actor->GetActorBase();
 		const auto female = base ? base->GetSex() == RE::SEXES::kFemale : false;
+		std::scoped_lock lock{ _m };
+		_applied.erase(a_actor->GetFormID());
 		if (transformInterface->RemoveNodeTransformScale(a_actor, false, female, basenode, namekey)) {
 			logger::info("Removed Transform Scale from {:X}", a_actor->GetFormID());
 			transformInterface->UpdateNodeTransforms(a_actor, false, female, basenode);
+			FragmentCache::GetSingleton()->Invalidate(a_actor->GetFormID());
 		}
   }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <mutex>
+#include <span>
+
 #include "API/IPluginInterface.h"
 #include "Registry/Define/RaceKey.h"
 
@@ -20,11 +23,46 @@ namespace Registry
 			Maximum = 3,
 		};
 
+		static constexpr float SCALE_TOLERANCE{ 0.03f };
+
+	public:
+		struct Request
+		{
+			RE::Actor* actor;
+			RaceKey racekey;
+			float scale;
+		};
+
 	public:
 		float GetScale(RE::TESObjectREFR* a_reference);
 		void SetScale(RE::Actor* a_reference, float a_absolutescale);
+		/// @brief Scale the actor to a_absolutescale, skipped if the actor is already within tolerance of the target
 		void SetScale(RE::Actor* a_reference, RaceKey a_racekey, float a_absolutescale);
+		/// @brief Scale every actor of a scene, all transforms are written before the skeletons are updated
+		void SetScale(std::span<const Request> a_requests);
 		void RemoveScale(RE::Actor* a_reference);
+		/// @brief Forget every applied transform, the skeletons of a loaded save are not ours to reuse
+		void Clear();
+
+	private:
+		/// @brief Read the scale from the actor's skeleton
+		float ReadScale(RE::TESObjectREFR* a_reference) const;
+		static float GetRaceScale(RaceKey a_racekey, float a_absolutescale);
+		bool IsEnabled();
+
+		/// @brief Write the transform for a_absolutescale without updating the skeleton. Requires _m to be held
+		/// @return If the transform changed and the actor needs UpdateNodeTransforms
+		bool WriteScale(RE::Actor* a_actor, float a_absolutescale);
+		void UpdateScale(RE::Actor* a_actor);
+
+		// Skeleton scale without our transform and the factor applied on top of it
+		struct Applied
+		{
+			float base;
+			float factor;
+		};
+		std::mutex _m{};
+		std::unordered_map<RE::FormID, Applied> _applied{};
 
 	private:
 		struct ScaleNodeVisitor : public SKEE::INiTransformInterface::NodeVisitor
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "Define/ActorProfile.h"
+
 namespace Registry
 {
   /// @brief Validate the given actor
   /// @return some code (-inf; 1]. 1 if the actor is valid. See implementation for details
 	int32_t IsValidActorImpl(RE::Actor* a_actor);
+	int32_t IsValidActorImpl(RE::Actor* a_actor, const ActorProfile& a_profile);
 	bool IsValidActor(RE::Actor* a_actor);
 } // namespace Registry
@@ -2,6 +2,9 @@
 
 #include "Papyrus/sslLibrary/Serialize.h"
 #include "Registry/Stats.h"
+#include "Registry/Util/FragmentCache.h"
+#include "Registry/Util/PlacementCache.h"
+#include "Registry/Util/Scale.h"
 
 namespace Serialization
 {
@@ -73,6 +76,9 @@ namespace Serialization
 		{
 			Registry::Statistics::StatisticsData::GetSingleton()->Revert(a_intfc);
 			Papyrus::Tracking::GetSingleton()->Revert(a_intfc);
+			Registry::FragmentCache::GetSingleton()->Clear();
+			Registry::PlacementCache::GetSingleton()->Clear();
+			Registry::Scale::GetSingleton()->Clear();
 		}
 
 		static void FormDeleteCallback(RE::VMHandle)
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace Thread
+{
+	/// @brief Per actor entries of a natively ticked scene system, kept sorted by actor, and the clock advancing them
+	/// Not synchronized, the owner guards it with its own lock. Entry needs a RE::FormID member named actor
+	template <class Entry>
+	class ActorSchedule
+	{
+	public:
+		static constexpr float MAX_UPDATE_STEP = 0.25f;	 // Seconds, longer gaps (menus, loading) do not fast-forward the entries
+
+	public:
+		_NODISCARD Entry* Find(RE::FormID a_actor)
+		{
+			const auto where = std::ranges::lower_bound(entries, a_actor, {}, &Entry::actor);
+			return where != entries.end() && where->actor == a_actor ? &*where : nullptr;
+		}
+
+		_NODISCARD bool Contains(RE::FormID a_actor) const
+		{
+			return std::ranges::binary_search(entries, a_actor, {}, &Entry::actor);
+		}
+
+		/// @brief The entry of a_actor, inserted from a_make() if there is none yet
+		template <class F>
+		Entry& FindOrInsert(RE::FormID a_actor, F a_make)
+		{
+			if (const auto entry = Find(a_actor))
+				return *entry;
+			const auto where = std::ranges::upper_bound(entries, a_actor, {}, &Entry::actor);
+			return *entries.insert(where, a_make());
+		}
+
+		/// @brief Remove the entry of a_actor. The clock restarts once the last entry is gone
+		/// @return The removed entry, or std::nullopt if a_actor had none
+		std::optional<Entry> Extract(RE::FormID a_actor)
+		{
+			const auto where = std::ranges::lower_bound(entries, a_actor, {}, &Entry::actor);
+			if (where == entries.end() || where->actor != a_actor)
+				return std::nullopt;
+			auto ret = std::move(*where);
+			entries.erase(where);
+			if (entries.empty()) {
+				lastUpdate = std::nullopt;
+			}
+			return ret;
+		}
+
+		/// @brief Seconds passed since the previous call, at most MAX_UPDATE_STEP
+		/// @return std::nullopt if there are no entries to advance
+		_NODISCARD std::optional<float> Tick()
+		{
+			if (entries.empty())
+				return std::nullopt;
+			const auto now = std::chrono::steady_clock::now();
+			const auto delta = lastUpdate ? std::chrono::duration<float>(now - *lastUpdate).count() : 0.0f;
+			lastUpdate = now;
+			return std::min(delta, MAX_UPDATE_STEP);
+		}
+
+		_NODISCARD bool empty() const { return entries.empty(); }
+		_NODISCARD size_t size() const { return entries.size(); }
+		auto begin() { return entries.begin(); }
+		auto end() { return entries.end(); }
+
+	private:
+		std::vector<Entry> entries{};
+		std::optional<std::chrono::steady_clock::time_point> lastUpdate{ std::nullopt };
+	};
+
+}	 // namespace Thread
@@ -0,0 +1,157 @@
+#include "ExpressionAnimator.h"
+
+#include "Registry/Library.h"
+
+namespace Thread
+{
+	using Registry::Expression;
+
+	void ExpressionAnimator::Register(RE::Actor* a_actor, const Expression* a_expression, float a_strength)
+	{
+		assert(a_actor);
+		const auto base = a_actor->GetActorBase();
+		const auto sex = base && base->GetSex() == RE::SEXES::kFemale ? RE::SEXES::kFemale : RE::SEXES::kMale;
+		std::scoped_lock lk{ _m };
+		auto& entry = entries.FindOrInsert(a_actor->GetFormID(), [&]() { return Entry{ a_actor->GetFormID(), sex, a_expression }; });
+		entry.expression = a_expression;
+		entry.strength = std::clamp(a_strength, 0.0f, 100.0f);
+		entry.retarget = true;
+	}
+
+	void ExpressionAnimator::Unregister(RE::FormID a_actor)
+	{
+		{
+			std::scoped_lock lk{ _m };
+			if (!entries.Extract(a_actor))
+				return;
+			if (entries.empty()) {
+				accumulator = 0.0f;
+			}
+		}
+		SKSE::GetTaskInterface()->AddTask([a_actor]() { Reset(a_actor); });
+	}
+
+	bool ExpressionAnimator::IsRegistered(RE::FormID a_actor) const
+	{
+		std::scoped_lock lk{ _m };
+		return entries.Contains(a_actor);
+	}
+
+	void ExpressionAnimator::SetExpression(RE::FormID a_actor, const Expression* a_expression)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor); entry && entry->expression != a_expression) {
+			entry->expression = a_expression;
+			entry->retarget = true;
+		}
+	}
+
+	void ExpressionAnimator::SetStrength(RE::FormID a_actor, float a_strength)
+	{
+		a_strength = std::clamp(a_strength, 0.0f, 100.0f);
+		std::scoped_lock lk{ _m };
+		// Strength is reported continuously, only whole steps are worth a new blend
+		if (auto entry = entries.Find(a_actor); entry && std::floor(entry->strength) != std::floor(a_strength)) {
+			entry->strength = a_strength;
+			entry->retarget = true;
+		}
+	}
+
+	std::vector<ExpressionAnimator::Frame> ExpressionAnimator::Advance(float a_seconds)
+	{
+		const auto step = 1.0f / std::max(Settings::fExpressionUpdateRate, 1.0f);
+		const auto blendTime = std::max(Settings::fExpressionBlendTime, step);
+		std::vector<Frame> ret{};
+		std::scoped_lock lk{ _m };
+		accumulator += a_seconds;
+		if (accumulator < step)
+			return ret;
+		const auto steps = std::floor(accumulator / step);
+		accumulator -= steps * step;
+		const auto delta = steps * step;
+		ret.reserve(entries.size());
+		for (auto&& entry : entries) {
+			if (entry.retarget) {
+				entry.retarget = false;
+				entry.source = entry.current;
+				if (entry.expression) {
+					entry.target = Registry::Library::GetSingleton()->GetExpressionData(entry.expression, entry.sex, entry.strength);
+				} else {
+					entry.target = GetNeutral();
+				}
+				entry.blend = 0.0f;
+			}
+			if (entry.blend >= 1.0f)
+				continue;
+			entry.blend = std::min(1.0f, entry.blend + delta / blendTime);
+			const auto t = Ease(entry.blend);
+			for (size_t i = 0; i < entry.current.size(); i++) {
+				entry.current[i] = std::lerp(entry.source[i], entry.target[i], t);
+			}
+			// Moods are discrete, switch halfway through the blend
+			entry.current[Expression::MoodType] = entry.blend < 0.5f ? entry.source[Expression::MoodType] : entry.target[Expression::MoodType];
+			ret.emplace_back(entry.actor, entry.current);
+		}
+		return ret;
+	}
+
+	void ExpressionAnimator::Update()
+	{
+		std::optional<float> delta;
+		{
+			std::scoped_lock lk{ _m };
+			delta = entries.Tick();
+		}
+		if (!delta)
+			return;
+		auto frames = Advance(*delta);
+		if (frames.empty())
+			return;
+		SKSE::GetTaskInterface()->AddTask([frames = std::move(frames)]() {
+			for (auto&& [actor, values] : frames) {
+				Apply(actor, values);
+			}
+		});
+	}
+
+	ExpressionAnimator::Values ExpressionAnimator::GetNeutral()
+	{
+		Values ret{};
+		ret[Expression::MoodType] = 7;
+		return ret;
+	}
+
+	float ExpressionAnimator::Ease(float a_t)
+	{
+		// Cubic ease-in-out
+		return a_t < 0.5f ? 4.0f * a_t * a_t * a_t : 1.0f - std::pow(-2.0f * a_t + 2.0f, 3.0f) / 2.0f;
+	}
+
+	void ExpressionAnimator::Apply(RE::FormID a_actor, const Values& a_values)
+	{
+		const auto actor = RE::TESForm::LookupByID<RE::Actor>(a_actor);
+		const auto data = actor ? actor->GetFaceGenAnimationData() : nullptr;
+		if (!data)
+			return;
+		auto& phonemes = data->phenomeKeyFrame;
+		for (uint32_t i = 0; i < Expression::Modifier - Expression::Phoneme && i < phonemes.count; i++) {
+			phonemes.values[i] = a_values[Expression::Phoneme + i];
+		}
+		auto& modifiers = data->modifierKeyFrame;
+		for (uint32_t i = 0; i < Expression::MoodType - Expression::Modifier && i < modifiers.count; i++) {
+			modifiers.values[i] = a_values[Expression::Modifier + i];
+		}
+		data->SetExpressionOverride(static_cast<uint32_t>(a_values[Expression::MoodType]), a_values[Expression::MoodValue]);
+	}
+
+	void ExpressionAnimator::Reset(RE::FormID a_actor)
+	{
+		const auto actor = RE::TESForm::LookupByID<RE::Actor>(a_actor);
+		const auto data = actor ? actor->GetFaceGenAnimationData() : nullptr;
+		if (!data)
+			return;
+		data->ClearExpressionOverride();
+		data->Reset(0.0f, true, true, true, false);
+	}
+
+}	 // namespace Thread
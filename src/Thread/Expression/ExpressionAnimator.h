@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Registry/Define/Expression.h"
+#include "Thread/ActorSchedule.h"
+
+namespace Thread
+{
+	/// @brief Blends the facial expressions of scene actors natively, on a fixed tick
+	/// Whenever an actor's expression or strength changes, its face eases from the values currently shown to the new keyframe
+	/// (Expression::GetData, which applies the expression's scaling mode) and all 32 values are written to the face at once
+	class ExpressionAnimator : public Singleton<ExpressionAnimator>
+	{
+	public:
+		using Values = std::array<float, Registry::Expression::ValueType::Total>;
+
+		struct Frame
+		{
+			RE::FormID actor;
+			Values values;
+		};
+
+	public:
+		void Register(RE::Actor* a_actor, const Registry::Expression* a_expression, float a_strength);
+		/// @brief Stop animating this actor and reset its face
+		void Unregister(RE::FormID a_actor);
+		_NODISCARD bool IsRegistered(RE::FormID a_actor) const;
+
+		void SetExpression(RE::FormID a_actor, const Registry::Expression* a_expression);
+		void SetStrength(RE::FormID a_actor, float a_strength);
+
+		/// @brief Advance all blends by a_seconds, in steps of the configured update rate
+		/// @return The values of every actor whose face changed, ordered by actor
+		_NODISCARD std::vector<Frame> Advance(float a_seconds);
+		/// @brief Advance by the time passed since the last call and apply the resulting frames
+		void Update();
+
+		_NODISCARD static Values GetNeutral();
+		_NODISCARD static float Ease(float a_t);
+
+	private:
+		struct Entry
+		{
+			RE::FormID actor;
+			RE::SEXES::SEX sex;
+			const Registry::Expression* expression;
+			float strength{ 0.0f };
+			bool retarget{ true };	// Expression or strength changed since the last step
+			float blend{ 1.0f };		// Progress from source to target, [0, 1]
+			Values source{ GetNeutral() };
+			Values target{ GetNeutral() };
+			Values current{ GetNeutral() };
+		};
+
+		static void Apply(RE::FormID a_actor, const Values& a_values);
+		static void Reset(RE::FormID a_actor);
+
+	private:
+		mutable std::mutex _m{};
+		ActorSchedule<Entry> entries{};
+		float accumulator{ 0.0f };	// Seconds not yet consumed by a whole update step
+	};
+
+}	 // namespace Thread
@@ -136,7 +136,7 @@ namespace Thread::Interface
 					RE::GFxValue arg;
 					view->CreateObject(&arg);
 					arg.SetMember("id", { edge->id.c_str() });
-					arg.SetMember("name", { edge->navtext.c_str() });
+					arg.SetMember("name", { edge->navtext.data() });
 					arg.SetMember("length", { edge->fixedlength > 0 });
 					bool hasClimax = false;
 					for (const auto& pos : edge->positions) {
@@ -1,6 +1,8 @@
 #include "NiUpdate.h"
 
 #include "NiMath.h"
+#include "Thread/Expression/ExpressionAnimator.h"
+#include "Thread/Voice/VoiceScheduler.h"
 
 namespace Thread::NiNode
 {
@@ -115,6 +117,8 @@ namespace Thread::NiNode
 	void NiUpdate::thunk(RE::NiAVObject* a_obj, RE::NiUpdateData* updateData)
 	{
 		func(a_obj, updateData);
+		VoiceScheduler::GetSingleton()->Update();
+		ExpressionAnimator::GetSingleton()->Update();
 		static const auto gameDaysPassed = RE::Calendar::GetSingleton()->gameDaysPassed;
 		if (!gameDaysPassed) {
 			return;
@@ -2,7 +2,9 @@
 
 #include "Registry/Library.h"
 #include "Registry/Util/Scale.h"
+#include "Thread/Expression/ExpressionAnimator.h"
 #include "Thread/Interface/SceneMenu.h"
+#include "Thread/Voice/VoiceScheduler.h"
 #include "Util/Script.h"
 
 namespace Thread
@@ -23,6 +25,21 @@ namespace Thread
 		}
 	}
 
+	Instance::~Instance()
+	{
+		const auto scheduler = VoiceScheduler::GetSingleton();
+		const auto animator = ExpressionAnimator::GetSingleton();
+		for (auto&& position : positions) {
+			scheduler->Unregister(position.data.GetActor()->GetFormID());
+			animator->Unregister(position.data.GetActor()->GetFormID());
+		}
+		SKSE::GetTaskInterface()->AddTask([prefetch = std::move(voicePrefetch)]() {
+			for (auto&& [_, handle] : *prefetch) {
+				handle.Stop();
+			}
+		});
+	}
+
 	void Instance::DestroyInstance(RE::TESQuest* a_linkedQst)
 	{
 		std::erase_if(instances, [&](const auto& instance) { return instance->linkedQst == a_linkedQst; });
@@ -78,15 +95,25 @@ namespace Thread
 			niInstance = NiNode::NiUpdate::Register(linkedQst->formID, *activeAssignment, activeScene);
 		}
 		activeStage = a_nextStage;
-		const auto scaling = Registry::Scale::GetSingleton();
+		std::vector<Registry::Scale::Request> scales{};
+		scales.reserve(activeAssignment->size());
+		for (size_t i = 0; i < activeAssignment->size(); i++) {
+			const auto& positionInfo = activeScene->GetNthPosition(i);
+			scales.push_back({ activeAssignment->at(i), positionInfo->data.GetRace(), positionInfo->data.GetScale() });
+		}
+		Registry::Scale::GetSingleton()->SetScale(scales);
+		const auto scheduler = VoiceScheduler::GetSingleton();
 		for (size_t i = 0; i < activeAssignment->size(); i++) {
 			const auto& actor = activeAssignment->at(i);
 			const auto& position = a_nextStage->positions[i];
+			REX::EnumSet<Registry::VoiceAnnotation> annotation{ Registry::VoiceAnnotation::None };
+			if (activeScene->CountSubmissives() > 0) {
+				annotation.set(activeScene->GetNthPosition(i)->IsSubmissive() ? Registry::VoiceAnnotation::Submissive : Registry::VoiceAnnotation::Dominant);
+			}
+			scheduler->SetAnnotation(actor->GetFormID(), annotation);
 			const auto& coordinate = position.offset.ApplyReturn(baseCoordinates);
-			const auto& positionInfo = activeScene->GetNthPosition(i);
 			const auto& animationEvent = activeScene->GetNthAnimationEvent(a_nextStage, i);
 
-			scaling->SetScale(actor, positionInfo->data.GetRace(), positionInfo->data.GetScale());
 			actor->SetAngle({ 0.0f, 0.0f, coordinate.rotation });
 			actor->SetPosition(coordinate.AsNiPoint(), true);
 			actor->Update3DPosition(true);
@@ -237,6 +264,8 @@ namespace Thread
 	void Instance::SetEnjoyment(RE::Actor* a_position, float a_enjoyment)
 	{
 		// COMEBACK: If enjoyment is moved into backend, update this
+		VoiceScheduler::GetSingleton()->SetExcitement(a_position->GetFormID(), a_enjoyment);
+		ExpressionAnimator::GetSingleton()->SetStrength(a_position->GetFormID(), a_enjoyment);
 		if (ControlsMenu()) {
 			Interface::SceneMenu::UpdateSlider(a_position->GetFormID(), a_enjoyment);
 		}
@@ -260,6 +289,7 @@ namespace Thread
 			return;
 		}
 		position->expression = a_expression;
+		ExpressionAnimator::GetSingleton()->SetExpression(a_actor->GetFormID(), a_expression);
 	}
 
 	const Registry::Voice* Instance::GetVoice(RE::Actor* a_actor)
@@ -279,7 +309,10 @@ namespace Thread
 			logger::warn("Actor {} is not part of the current scene.", a_actor->GetFormID());
 			return;
 		}
-		position->voice = a_voice;
+		const auto previous = std::exchange(position->voice, a_voice);
+		VoiceScheduler::GetSingleton()->SetVoice(a_actor->GetFormID(), a_voice);
+		PrefetchVoice(a_voice);
+		ReleaseVoice(previous);
 	}
 
 	bool Instance::IsGhostMode(RE::Actor* a_actor)
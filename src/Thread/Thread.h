@@ -58,7 +58,7 @@ namespace Thread
 
 	public:
 		Instance(RE::TESQuest* a_linkedQst, const std::vector<RE::Actor*>& a_submissives, const SceneMapping& a_scenes, FurniturePreference a_furniturePreference);
-		~Instance() = default;
+		~Instance();
 
 		static bool CreateInstance(RE::TESQuest* a_linkedQst, const std::vector<RE::Actor*> a_submissives, const SceneMapping& a_scenes, FurniturePreference a_furniturePreference);
 		static void DestroyInstance(RE::TESQuest* a_linkedQst);
@@ -116,6 +116,9 @@ namespace Thread
 		const Registry::Scene* activeScene{ nullptr };
 		const Registry::Stage* activeStage{ nullptr };
 		SceneMapping scenes{};
+		// Sounds of all position voices, loaded ahead of their first play. Shared with the main thread tasks that own the handles
+		using PrefetchMap = std::unordered_map<const RE::TESSound*, RE::BSSoundHandle>;
+		std::shared_ptr<PrefetchMap> voicePrefetch{ std::make_shared<PrefetchMap>() };
 
 	private:
 		enum class CenterSelection
@@ -132,6 +135,8 @@ namespace Thread
 		CenterSelection GetSelectionMethod(FurniturePreference furniturePreference);
 		FurnitureMapping::value_type SelectCenterRefMenu(const FurnitureMapping& a_furnitures, RE::Actor* a_tmpCenter);
 		FurnitureMapping GetUniqueFurnituesOfTypeInBound(RE::Actor* a_centerAct, REX::EnumSet<Registry::FurnitureType::Value> a_furnitureTypes);
+		void PrefetchVoice(const Registry::Voice* a_voice);
+		void ReleaseVoice(const Registry::Voice* a_voice);
 
 	private:
 		static inline std::vector<std::unique_ptr<Instance>> instances{};
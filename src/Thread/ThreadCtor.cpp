@@ -43,6 +43,53 @@ namespace Thread
 		const auto firstScene = Random::draw(scenes[SceneType::LeadIn].empty() ? priorityScenes : scenes[SceneType::LeadIn]);
 		[[maybe_unused]] const auto success = SetActiveScene(firstScene);
 		assert(success && "Failed to set active scene.");
+		for (auto&& position : positions) {
+			PrefetchVoice(position.voice);
+		}
+	}
+
+	void Instance::PrefetchVoice(const Registry::Voice* a_voice)
+	{
+		if (!a_voice)
+			return;
+		// Building the sound data resolves the descriptor and starts loading its file, so that the first play does not stall on it
+		// Instances are created and edited from the Papyrus VM, the audio manager is only touched on the main thread
+		SKSE::GetTaskInterface()->AddTask([prefetch = voicePrefetch, sounds = a_voice->GetSounds()]() {
+			const auto audio = RE::BSAudioManager::GetSingleton();
+			for (auto&& sound : sounds) {
+				if (!sound->descriptor || prefetch->contains(sound))
+					continue;
+				RE::BSSoundHandle handle{};
+				if (audio->BuildSoundDataFromDescriptor(handle, sound->descriptor)) {
+					prefetch->emplace(sound, handle);
+				}
+			}
+		});
+	}
+
+	void Instance::ReleaseVoice(const Registry::Voice* a_voice)
+	{
+		if (!a_voice)
+			return;
+		// Keep the sounds that another position's voice may still play
+		std::vector<RE::TESSound*> used{};
+		for (auto&& position : positions) {
+			if (position.voice)
+				std::ranges::copy(position.voice->GetSounds(), std::back_inserter(used));
+		}
+		auto sounds = a_voice->GetSounds();
+		std::erase_if(sounds, [&](auto sound) { return std::ranges::contains(used, sound); });
+		if (sounds.empty())
+			return;
+		SKSE::GetTaskInterface()->AddTask([prefetch = voicePrefetch, sounds = std::move(sounds)]() {
+			for (auto&& sound : sounds) {
+				const auto where = prefetch->find(sound);
+				if (where == prefetch->end())
+					continue;
+				where->second.Stop();
+				prefetch->erase(where);
+			}
+		});
 	}
 
 	RE::Actor* Instance::InitializeReferences(const std::vector<RE::Actor*>& a_submissives)
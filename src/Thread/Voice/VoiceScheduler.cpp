@@ -0,0 +1,167 @@
+#include "VoiceScheduler.h"
+
+#include "Registry/Library.h"
+
+namespace Thread
+{
+	void VoiceScheduler::Register(RE::Actor* a_actor, const Registry::Voice* a_voice)
+	{
+		assert(a_actor);
+		std::scoped_lock lk{ _m };
+		auto& entry = entries.FindOrInsert(a_actor->GetFormID(), [&]() { return Entry{ a_actor->GetFormID(), a_voice }; });
+		entry.voice = a_voice;
+		// Stagger the first sound so that actors registered together do not start in unison
+		entry.timer = std::uniform_real_distribution<float>{ 0.0f, NextDelay(entry) }(rng);
+	}
+
+	void VoiceScheduler::Unregister(RE::FormID a_actor)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Extract(a_actor)) {
+			entry->handle.Stop();
+		}
+	}
+
+	bool VoiceScheduler::IsRegistered(RE::FormID a_actor) const
+	{
+		std::scoped_lock lk{ _m };
+		return entries.Contains(a_actor);
+	}
+
+	void VoiceScheduler::SetVoice(RE::FormID a_actor, const Registry::Voice* a_voice)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			entry->voice = a_voice;
+		}
+	}
+
+	void VoiceScheduler::SetExcitement(RE::FormID a_actor, float a_excitement)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			entry->excitement = std::clamp(a_excitement, 0.0f, 100.0f);
+		}
+	}
+
+	void VoiceScheduler::SetInterval(RE::FormID a_actor, Interval a_interval)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			const auto min = std::max(a_interval.min, 0.1f);
+			entry->interval = { min, std::max(a_interval.max, min) };
+			entry->timer = std::min(entry->timer, entry->interval.max);
+		}
+	}
+
+	void VoiceScheduler::SetAnnotation(RE::FormID a_actor, REX::EnumSet<Registry::VoiceAnnotation> a_annotation)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			entry->annotation = a_annotation;
+			entry->annotation.reset(Registry::VoiceAnnotation::Muffled);
+		}
+	}
+
+	void VoiceScheduler::SetMuffled(RE::FormID a_actor, bool a_muffled)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			entry->muffled = a_muffled;
+		}
+	}
+
+	void VoiceScheduler::QueueOrgasm(RE::FormID a_actor)
+	{
+		std::scoped_lock lk{ _m };
+		if (auto entry = entries.Find(a_actor)) {
+			entry->orgasm = true;
+		}
+	}
+
+	std::vector<VoiceScheduler::Cue> VoiceScheduler::Advance(float a_seconds)
+	{
+		const auto library = Registry::Library::GetSingleton();
+		std::vector<Cue> ret{};
+		std::scoped_lock lk{ _m };
+		for (auto&& entry : entries) {
+			if (!entry.voice)
+				continue;
+			auto annotation = entry.annotation;
+			if (entry.muffled) {
+				annotation.set(Registry::VoiceAnnotation::Muffled);
+			}
+			if (entry.orgasm) {
+				entry.orgasm = false;
+				// Leave the orgasm sound room before the next regular sound
+				entry.timer = entry.interval.max;
+				if (auto sound = library->PickOrgasmSound(entry.voice->GetId(), annotation)) {
+					ret.emplace_back(entry.actor, sound, true);
+				}
+				continue;
+			}
+			entry.timer -= a_seconds;
+			if (entry.timer > 0.0f)
+				continue;
+			entry.timer = NextDelay(entry);
+			if (auto sound = library->PickSound(entry.voice->GetId(), static_cast<uint32_t>(entry.excitement), annotation)) {
+				ret.emplace_back(entry.actor, sound, false);
+			}
+		}
+		return ret;
+	}
+
+	void VoiceScheduler::Update()
+	{
+		std::optional<float> delta;
+		{
+			std::scoped_lock lk{ _m };
+			delta = entries.Tick();
+		}
+		if (!delta)
+			return;
+		auto cues = Advance(*delta);
+		if (cues.empty())
+			return;
+		SKSE::GetTaskInterface()->AddTask([this, cues = std::move(cues)]() {
+			for (auto&& cue : cues) {
+				Play(cue);
+			}
+		});
+	}
+
+	float VoiceScheduler::NextDelay(const Entry& a_entry)
+	{
+		const auto& [min, max] = a_entry.interval;
+		const auto delay = std::lerp(max, min, a_entry.excitement / 100.0f);
+		const auto jitter = std::clamp(Settings::fVoiceIntervalJitter, 0.0f, 1.0f);
+		return delay * std::uniform_real_distribution<float>{ 1.0f - jitter, 1.0f + jitter }(rng);
+	}
+
+	void VoiceScheduler::Play(const Cue& a_cue)
+	{
+		const auto actor = RE::TESForm::LookupByID<RE::Actor>(a_cue.actor);
+		const auto root = actor ? actor->Get3D() : nullptr;
+		if (!root || !a_cue.sound || !a_cue.sound->descriptor)
+			return;
+		std::scoped_lock lk{ _m };
+		const auto entry = entries.Find(a_cue.actor);
+		if (!entry)
+			return;
+		if (entry->handle.IsPlaying()) {
+			// Regular sounds never cut each other off, an orgasm takes precedence
+			if (!a_cue.orgasm)
+				return;
+			entry->handle.Stop();
+		}
+		RE::BSSoundHandle handle{};
+		if (!RE::BSAudioManager::GetSingleton()->BuildSoundDataFromDescriptor(handle, a_cue.sound->descriptor)) {
+			logger::error("Failed to build sound {:X} for actor {:X}", a_cue.sound->GetFormID(), a_cue.actor);
+			return;
+		}
+		handle.SetObjectToFollow(root);
+		handle.Play();
+		entry->handle = handle;
+	}
+
+}	 // namespace Thread
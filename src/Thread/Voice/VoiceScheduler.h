@@ -0,0 +1,70 @@
+#pragma once
+
+#include <random>
+
+#include "Registry/Define/Voice.h"
+#include "Thread/ActorSchedule.h"
+
+namespace Thread
+{
+	/// @brief Plays the voices of scene actors natively, timed by their excitement
+	/// Replaces a per actor Papyrus loop polling the voice natives. Advance() picks the due sounds, Update() plays them on the main thread
+	class VoiceScheduler : public Singleton<VoiceScheduler>
+	{
+	public:
+		struct Interval
+		{
+			float min{ Settings::fVoiceIntervalMin };	 // Seconds between sounds at full excitement
+			float max{ Settings::fVoiceIntervalMax };	 // Seconds between sounds at no excitement
+		};
+
+		struct Cue
+		{
+			RE::FormID actor;
+			RE::TESSound* sound;
+			bool orgasm;
+		};
+
+	public:
+		void Register(RE::Actor* a_actor, const Registry::Voice* a_voice);
+		void Unregister(RE::FormID a_actor);
+		_NODISCARD bool IsRegistered(RE::FormID a_actor) const;
+
+		void SetVoice(RE::FormID a_actor, const Registry::Voice* a_voice);
+		void SetExcitement(RE::FormID a_actor, float a_excitement);
+		void SetInterval(RE::FormID a_actor, Interval a_interval);
+		/// @brief Set the submissive/dominant annotation, the muffled state is kept
+		void SetAnnotation(RE::FormID a_actor, REX::EnumSet<Registry::VoiceAnnotation> a_annotation);
+		void SetMuffled(RE::FormID a_actor, bool a_muffled);
+		void QueueOrgasm(RE::FormID a_actor);
+
+		/// @brief Advance all schedules by a_seconds
+		/// @return The sounds due to be played, ordered by actor
+		_NODISCARD std::vector<Cue> Advance(float a_seconds);
+		/// @brief Advance by the time passed since the last call and play all due sounds
+		void Update();
+
+	private:
+		struct Entry
+		{
+			RE::FormID actor;
+			const Registry::Voice* voice;
+			REX::EnumSet<Registry::VoiceAnnotation> annotation{ Registry::VoiceAnnotation::None };
+			bool muffled{ false };
+			bool orgasm{ false };
+			float excitement{ 0.0f };
+			Interval interval{};
+			float timer{ 0.0f };	// Seconds until the next sound
+			RE::BSSoundHandle handle{};
+		};
+
+		_NODISCARD float NextDelay(const Entry& a_entry);
+		void Play(const Cue& a_cue);
+
+	private:
+		mutable std::mutex _m{};
+		ActorSchedule<Entry> entries{};
+		std::mt19937 rng{ std::random_device{}() };
+	};
+
+}	 // namespace Thread
@@ -2,6 +2,8 @@
 #include "Registry/CumFx.h"
 #include "Registry/Library.h"
 #include "Registry/Stats.h"
+#include "Registry/Util/FragmentCache.h"
+#include "Registry/Util/PlacementCache.h"
 #include "Serialization.h"
 #include "Thread/Interface/SceneMenu.h"
 #include "Thread/Interface/SelectionMenu.h"
@@ -127,6 +129,8 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
 	serialization->SetFormDeleteCallback(Serialization::Serialize::FormDeleteCallback);
 
 	Registry::Statistics::StatisticsData::GetSingleton()->Register();
+	Registry::FragmentCache::GetSingleton()->Register();
+	Registry::PlacementCache::GetSingleton()->Register();
 
 	logger::info("Initialization complete");
 